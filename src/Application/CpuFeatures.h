@@ -0,0 +1,78 @@
+#pragma once
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "Types/ESimd.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define GOLD_RUSH_X86 1
+#else
+#define GOLD_RUSH_X86 0
+#endif
+
+// Functions that use AVX2 intrinsics are compiled with the AVX2 target enabled, but only
+// ever called after CpuFeatures reports that the CPU supports it, so the binary itself
+// still runs on any x86-64 machine.
+//
+#if GOLD_RUSH_X86 && (defined(__GNUC__) || defined(__clang__))
+#define GOLD_RUSH_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define GOLD_RUSH_TARGET_AVX2
+#endif
+
+class CpuFeatures
+{
+public:
+    static bool HasSse2();
+    static bool HasAvx2();
+    static SIMDLEVELenum GetSimdLevel();
+
+private:
+    CpuFeatures();
+};
+
+inline bool CpuFeatures::HasSse2()
+{
+#if GOLD_RUSH_X86 && (defined(__x86_64__) || defined(_M_X64))
+    // SSE2 is part of the x86-64 baseline.
+    //
+    return true;
+#elif GOLD_RUSH_X86 && (defined(__GNUC__) || defined(__clang__))
+    return __builtin_cpu_supports("sse2");
+#else
+    return false;
+#endif
+}
+
+inline bool CpuFeatures::HasAvx2()
+{
+#if GOLD_RUSH_X86 && (defined(__GNUC__) || defined(__clang__))
+    return __builtin_cpu_supports("avx2");
+#elif GOLD_RUSH_X86 && defined(_MSC_VER)
+    // Leaf 7, sub-leaf 0, EBX bit 5 is AVX2. The OS must also save the YMM state, which
+    // is what the OSXSAVE bit and XCR0 check.
+    //
+    int info[4];
+    __cpuid(info, 1);
+    bool os_xsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    if (!os_xsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+    {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return false;
+#endif
+}
+
+inline SIMDLEVELenum CpuFeatures::GetSimdLevel()
+{
+    static const SIMDLEVELenum level = HasAvx2()   ? SIMDLEVELenum::AVX2
+                                       : HasSse2() ? SIMDLEVELenum::SSE2
+                                                   : SIMDLEVELenum::SCALAR;
+    return level;
+}
@@ -0,0 +1,108 @@
+#include "Application/MappedFile.h"
+
+MappedFile::MappedFile()
+    : data_(nullptr), size_(0),
+#if defined(_WIN32)
+      file_(INVALID_HANDLE_VALUE), mapping_(nullptr)
+#else
+      file_(-1)
+#endif
+{
+}
+
+MappedFile::~MappedFile() { Close(); }
+
+bool MappedFile::Open(const std::string &_path, const bool _writable)
+{
+    Close();
+#if defined(_WIN32)
+    file_ = CreateFileA(_path.c_str(),
+                        _writable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ,
+                        FILE_SHARE_READ,
+                        nullptr,
+                        OPEN_EXISTING,
+                        FILE_ATTRIBUTE_NORMAL,
+                        nullptr);
+    LARGE_INTEGER file_size;
+    if (file_ == INVALID_HANDLE_VALUE || !GetFileSizeEx(file_, &file_size) ||
+        file_size.QuadPart == 0)
+    {
+        Close();
+        return false;
+    }
+    mapping_ = CreateFileMappingA(
+        file_, nullptr, _writable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, nullptr);
+    if (mapping_ == nullptr)
+    {
+        Close();
+        return false;
+    }
+    data_ = (uint8_t *)MapViewOfFile(
+        mapping_, _writable ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ, 0, 0, 0);
+    size_ = (uint64_t)file_size.QuadPart;
+#else
+    file_ = ::open(_path.c_str(), _writable ? O_RDWR : O_RDONLY);
+    struct stat file_stat;
+    if (file_ < 0 || fstat(file_, &file_stat) != 0 || file_stat.st_size == 0)
+    {
+        Close();
+        return false;
+    }
+    void *data = mmap(nullptr,
+                      (std::size_t)file_stat.st_size,
+                      _writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                      MAP_SHARED,
+                      file_,
+                      0);
+    data_ = data == MAP_FAILED ? nullptr : (uint8_t *)data;
+    size_ = (uint64_t)file_stat.st_size;
+#endif
+    if (data_ == nullptr)
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void MappedFile::Close()
+{
+#if defined(_WIN32)
+    if (data_ != nullptr)
+    {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_ != nullptr)
+    {
+        CloseHandle(mapping_);
+    }
+    if (file_ != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(file_);
+    }
+    mapping_ = nullptr;
+    file_ = INVALID_HANDLE_VALUE;
+#else
+    if (data_ != nullptr)
+    {
+        munmap(data_, (std::size_t)size_);
+    }
+    if (file_ >= 0)
+    {
+        ::close(file_);
+    }
+    file_ = -1;
+#endif
+    data_ = nullptr;
+    size_ = 0;
+}
+
+void MappedFile::AdviseRandomAccess()
+{
+#if !defined(_WIN32)
+    if (data_ != nullptr)
+    {
+        madvise(data_, (std::size_t)size_, MADV_RANDOM);
+    }
+#endif
+}
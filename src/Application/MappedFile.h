@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// A whole file mapped into memory, mmap on POSIX and a file mapping view on Windows.
+//
+// Nothing is read up front, the pages are read in when they are first touched and the OS may
+// drop them again under memory pressure, so files far larger than RAM can be mapped. A
+// writable mapping is shared, writes reach the file.
+//
+class MappedFile
+{
+public:
+    MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    ~MappedFile();
+
+    bool Open(const std::string &_path, const bool _writable = false);
+    void Close();
+
+    // Hint that the file is read in scattered pieces, so the OS does not read ahead of every
+    // touched page. No effect on Windows.
+    //
+    void AdviseRandomAccess();
+
+    bool IsOpen() const;
+    uint8_t *GetData() const;
+    uint64_t GetSize() const;
+
+private:
+    uint8_t *data_;
+    uint64_t size_;
+#if defined(_WIN32)
+    HANDLE file_, mapping_;
+#else
+    int file_;
+#endif
+};
+
+inline bool MappedFile::IsOpen() const { return data_ != nullptr; }
+
+inline uint8_t *MappedFile::GetData() const { return data_; }
+
+inline uint64_t MappedFile::GetSize() const { return size_; }
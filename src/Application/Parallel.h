@@ -0,0 +1,88 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+class Parallel
+{
+public:
+    static uint32_t GetThreadCount();
+
+    // Splits [begin, end) into chunks of _grain items and runs fn(chunk_begin, chunk_end) on
+    // every core. Chunks are handed out dynamically, so uneven chunks still balance out.
+    // The calling thread takes part in the work and the call returns once all chunks are done.
+    //
+    template <class F>
+    static void For(const uint32_t _begin, const uint32_t _end, const uint32_t _grain, F fn);
+
+    // Makes For run all chunks on the calling thread. For threads that already share the cores
+    // with others, like the terrain streaming workers, where starting threads for every call
+    // would only oversubscribe them. A For called from inside a For is always serial.
+    //
+    static void SetSerial(const bool _serial);
+
+private:
+    Parallel();
+
+    static bool &isSerial();
+};
+
+inline uint32_t Parallel::GetThreadCount()
+{
+    static const uint32_t count = std::max(1u, std::thread::hardware_concurrency());
+    return count;
+}
+
+inline void Parallel::SetSerial(const bool _serial) { isSerial() = _serial; }
+
+inline bool &Parallel::isSerial()
+{
+    static thread_local bool serial = false;
+    return serial;
+}
+
+template <class F>
+inline void Parallel::For(const uint32_t _begin, const uint32_t _end, const uint32_t _grain, F fn)
+{
+    if (_end <= _begin)
+    {
+        return;
+    }
+
+    uint32_t grain = std::max(1u, _grain);
+    uint32_t chunks = (_end - _begin + grain - 1) / grain;
+    uint32_t workers = std::min(GetThreadCount(), chunks);
+
+    if (workers <= 1 || isSerial())
+    {
+        fn(_begin, _end);
+        return;
+    }
+
+    std::atomic<uint32_t> next_chunk(0);
+    auto work = [&]() {
+        isSerial() = true;
+        for (uint32_t c = next_chunk++; c < chunks; c = next_chunk++)
+        {
+            uint32_t chunk_begin = _begin + c * grain;
+            uint32_t chunk_end = std::min(_end, chunk_begin + grain);
+            fn(chunk_begin, chunk_end);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (uint32_t i = 0; i < workers - 1; i++)
+    {
+        threads.emplace_back(work);
+    }
+    work();
+    isSerial() = false;
+    for (std::size_t i = 0; i < threads.size(); i++)
+    {
+        threads.at(i).join();
+    }
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+// The model matrices of an instanced draw, kept on the GPU between frames.
+//
+// Data uploads all of them, Set replaces a single one and Resize drops the ones past the new
+// count, so a change to a few instances only moves those few matrices to the GPU. The buffer
+// only grows, a smaller upload reuses it.
+//
+class InstanceBuffer
+{
+public:
+    InstanceBuffer();
+    ~InstanceBuffer();
+    InstanceBuffer(const InstanceBuffer &) = delete;
+    InstanceBuffer &operator=(const InstanceBuffer &) = delete;
+
+    void Data(const std::vector<glm::mat4> &instances);
+    void Set(const uint32_t _index, const glm::mat4 &instance);
+    void Resize(const uint32_t _count);
+
+    // Binds the buffer to GL_ARRAY_BUFFER, where Mesh::DrawInstanced reads the matrices.
+    //
+    void Bind();
+    void Unbind();
+
+    uint32_t GetCount() const;
+
+private:
+    uint32_t id_;
+    uint32_t count_;
+    uint32_t capacity_;
+
+    void generate();
+    void remove();
+};
+
+inline InstanceBuffer::InstanceBuffer() : count_(0), capacity_(0) { generate(); }
+
+inline InstanceBuffer::~InstanceBuffer() { remove(); }
+
+inline void InstanceBuffer::Data(const std::vector<glm::mat4> &instances)
+{
+    count_ = (uint32_t)instances.size();
+    Bind();
+    if (count_ > capacity_)
+    {
+        capacity_ = count_;
+        glBufferData(GL_ARRAY_BUFFER,
+                     capacity_ * sizeof(glm::mat4),
+                     instances.data(),
+                     GL_STATIC_DRAW);
+    }
+    else if (count_ > 0)
+    {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, count_ * sizeof(glm::mat4), instances.data());
+    }
+    Unbind();
+}
+
+inline void InstanceBuffer::Set(const uint32_t _index, const glm::mat4 &instance)
+{
+    if (_index >= count_)
+    {
+        std::cout << "ERROR::INSTANCEBUFFER::SET::INDEX_OUT_OF_RANGE " << _index << std::endl;
+        return;
+    }
+    Bind();
+    glBufferSubData(
+        GL_ARRAY_BUFFER, _index * sizeof(glm::mat4), sizeof(glm::mat4), glm::value_ptr(instance));
+    Unbind();
+}
+
+inline void InstanceBuffer::Resize(const uint32_t _count)
+{
+    if (_count > count_)
+    {
+        std::cout << "ERROR::INSTANCEBUFFER::RESIZE::CANNOT_GROW " << _count << std::endl;
+        return;
+    }
+    count_ = _count;
+}
+
+inline void InstanceBuffer::Bind() { glBindBuffer(GL_ARRAY_BUFFER, id_); }
+
+inline void InstanceBuffer::Unbind() { glBindBuffer(GL_ARRAY_BUFFER, 0); }
+
+inline uint32_t InstanceBuffer::GetCount() const { return count_; }
+
+inline void InstanceBuffer::generate() { glGenBuffers(1, &id_); }
+
+inline void InstanceBuffer::remove() { glDeleteBuffers(1, &id_); }
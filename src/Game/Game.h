@@ -1,35 +1,40 @@
-#pragma once
-
-#include <iostream>
-
-#include <glad/glad.h>
-#include <GLFW/glfw3.h>
-#include <glm/glm.hpp>
-#include <glm/gtc/matrix_transform.hpp>
-
-#include "Application/Window.h"
-#include "Game/Player.h"
-#include "Renderer/Camera.h"
-#include "Renderer/Renderer.h"
-#include "World/GameWorld.h"
-
-class Game
-{
-public:
-    Game(Window &window);
-
-    void Start();
-
-    void HandleFramebuffer(GLFWwindow *window, int width, int height);
-    void HandleMouse(GLFWwindow *window, double x_pos, double y_pos);
-
-private:
-    Renderer renderer_;
-    Camera camera_;
-    GameWorld game_world_;
-    Player player_;
-
-    static const glm::vec3 _DEFAULT_CAMERA_POSITION_;
-    static const glm::vec3 _DEFAULT_PLAYER_POSITION_;
-    static const glm::vec3 _WORLD_CENTER_;
-};
+#pragma once
+
+#include <iostream>
+#include <string>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "Application/Window.h"
+#include "Game/Player.h"
+#include "Renderer/Camera.h"
+#include "Renderer/Renderer.h"
+#include "World/GameWorld.h"
+
+class Game
+{
+public:
+    Game(Window &window);
+
+    void Start();
+
+    void HandleFramebuffer(GLFWwindow *window, int width, int height);
+    void HandleMouse(GLFWwindow *window, double x_pos, double y_pos);
+
+private:
+    Renderer renderer_;
+    Camera camera_;
+    GameWorld game_world_;
+    Player player_;
+
+    static const glm::vec3 _DEFAULT_CAMERA_POSITION_;
+    static const glm::vec3 _DEFAULT_PLAYER_POSITION_;
+    static const glm::vec3 _WORLD_CENTER_;
+    static const uint32_t _WORLD_SEED_;
+    static const std::string _DEM_PATH_;
+    static const TERRAINMODEenum _TERRAIN_MODE_;
+    static const TERRAINRENDERenum _TERRAIN_RENDER_;
+};
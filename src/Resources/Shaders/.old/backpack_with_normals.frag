@@ -1,12 +1,12 @@
-#version 420 core
-
-//in vec2 TexCoords;
-
-//uniform sampler2D texture_diffuse_1;
-//uniform sampler2D texture_specular_1;
-//uniform sampler2D texture_normal_1;
-
-void main()
-{
-	gl_FragColor = vec4(1.0, 1.0, 0.0, 1.0);
+#version 420 core
+
+//in vec2 TexCoords;
+
+//uniform sampler2D texture_diffuse_1;
+//uniform sampler2D texture_specular_1;
+//uniform sampler2D texture_normal_1;
+
+void main()
+{
+	gl_FragColor = vec4(1.0, 1.0, 0.0, 1.0);
 }
\ No newline at end of file
@@ -1,12 +1,12 @@
-#version 330 core
-
-in vec2 TexCoords;
-
-uniform sampler2D texture1;
-
-void main()
-{    
-    vec4 texColor = texture(texture1, TexCoords);
-    if(texColor.a < 0.1) discard;
-    gl_FragColor = texColor;
+#version 330 core
+
+in vec2 TexCoords;
+
+uniform sampler2D texture1;
+
+void main()
+{    
+    vec4 texColor = texture(texture1, TexCoords);
+    if(texColor.a < 0.1) discard;
+    gl_FragColor = texColor;
 }
\ No newline at end of file
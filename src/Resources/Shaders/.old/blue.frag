@@ -1,6 +1,6 @@
-#version 420 core
-
-void main()
-{
-    gl_FragColor = vec4(0.0, 0.0, 1.0, 1.0); // Set color to blue.
+#version 420 core
+
+void main()
+{
+    gl_FragColor = vec4(0.0, 0.0, 1.0, 1.0); // Set color to blue.
 }
\ No newline at end of file
@@ -1,16 +1,16 @@
-#version 420 core
-
-layout (location = 0) in vec3 aPos;
-
-layout (std140, binding = 0) uniform Matrices
-{
-    mat4 projection;
-    mat4 view;
-};
-
-uniform mat4 model;
-
-void main()
-{
-    gl_Position = projection * view * model * vec4(aPos, 1.0);
+#version 420 core
+
+layout (location = 0) in vec3 aPos;
+
+layout (std140, binding = 0) uniform Matrices
+{
+    mat4 projection;
+    mat4 view;
+};
+
+uniform mat4 model;
+
+void main()
+{
+    gl_Position = projection * view * model * vec4(aPos, 1.0);
 }
\ No newline at end of file
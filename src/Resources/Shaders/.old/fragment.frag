@@ -1,13 +1,13 @@
-#version 330 core
-
-in vec2 TexCoord;
-
-uniform sampler2D texture1;
-uniform sampler2D texture2;
-
-out vec4 FragColor;
-
-void main()
-{
-	FragColor = mix(texture(texture1, TexCoord), texture(texture2, TexCoord), 0.5);
+#version 330 core
+
+in vec2 TexCoord;
+
+uniform sampler2D texture1;
+uniform sampler2D texture2;
+
+out vec4 FragColor;
+
+void main()
+{
+	FragColor = mix(texture(texture1, TexCoord), texture(texture2, TexCoord), 0.5);
 }
\ No newline at end of file
@@ -1,10 +1,10 @@
-#version 330 core
-
-uniform vec3 lightSourceColor;
-
-out vec4 FragColor;
-
-void main()
-{
-	FragColor = vec4(lightSourceColor, 1.0);
+#version 330 core
+
+uniform vec3 lightSourceColor;
+
+out vec4 FragColor;
+
+void main()
+{
+	FragColor = vec4(lightSourceColor, 1.0);
 }
\ No newline at end of file
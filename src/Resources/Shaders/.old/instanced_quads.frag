@@ -1,8 +1,8 @@
-#version 420 core
-
-in vec3 vsout_fColor;
-
-void main()
-{
-    gl_FragColor = vec4(vsout_fColor, 1.0);
+#version 420 core
+
+in vec3 vsout_fColor;
+
+void main()
+{
+    gl_FragColor = vec4(vsout_fColor, 1.0);
 }
\ No newline at end of file
@@ -1,6 +1,6 @@
-#version 330 core
-
-void main()
-{    
-    gl_FragColor = vec4(1.0, 0.0, 0.0, 1.0);
+#version 330 core
+
+void main()
+{    
+    gl_FragColor = vec4(1.0, 0.0, 0.0, 1.0);
 }
\ No newline at end of file
@@ -1,10 +1,10 @@
-#version 420 core
-
-in vec3 TexCoords;
-
-uniform samplerCube skybox;
-
-void main()
-{
-	gl_FragColor = texture(skybox, TexCoords);
+#version 420 core
+
+in vec3 TexCoords;
+
+uniform samplerCube skybox;
+
+void main()
+{
+	gl_FragColor = texture(skybox, TexCoords);
 }
\ No newline at end of file
@@ -1,10 +1,10 @@
-#version 330 core
-
-in vec2 TexCoords;
-
-uniform sampler2D texture1;
-
-void main()
-{    
-    gl_FragColor = texture(texture1, TexCoords);
+#version 330 core
+
+in vec2 TexCoords;
+
+uniform sampler2D texture1;
+
+void main()
+{    
+    gl_FragColor = texture(texture1, TexCoords);
 }
\ No newline at end of file
@@ -1,6 +1,6 @@
-#version 420 core
-
-void main()
-{
-    gl_FragColor = vec4(1.0, 1.0, 102.0 / 255.0, 1.0); // Set color to yellow.
+#version 420 core
+
+void main()
+{
+    gl_FragColor = vec4(1.0, 1.0, 102.0 / 255.0, 1.0); // Set color to yellow.
 }
\ No newline at end of file
@@ -0,0 +1,95 @@
+#version 420 core
+
+/*
+* Fractal gradient noise, one height map sample per fragment. This mirrors
+* NoiseGenerator on the CPU: the same lattice hash, gradients, fade curve and
+* octave weights, so both paths agree up to float rounding.
+*/
+layout (location = 0) out float height;
+
+const int MAX_OCTAVES = 16;
+
+uniform ivec2 origin;
+uniform int octaves;
+uniform int wrap;
+uniform int pitch[MAX_OCTAVES];
+uniform uint octaveSeed[MAX_OCTAVES];
+uniform float octaveScale[MAX_OCTAVES];
+uniform float scaleAcc;
+uniform float amplitude;
+
+uint Hash(uint seed, int x, int y)
+{
+    uint h = seed ^ (uint(x) * 0x27d4eb2du) ^ (uint(y) * 0x165667b1u);
+    h ^= h >> 15;
+    h *= 0x2c1b3c6du;
+    h ^= h >> 12;
+    h *= 0x297a2d39u;
+    h ^= h >> 15;
+    return h;
+}
+
+float Fade(float t)
+{
+    return t * t * t * (t * (t * 6.0 - 15.0) + 10.0);
+}
+
+float Grad(uint hash, float x, float y)
+{
+    uint h = hash & 7u;
+    float u = (h & 4u) == 0u ? x : y;
+    float v = (h & 4u) == 0u ? y : x;
+    u = (h & 1u) == 0u ? u : -u;
+    v = (h & 2u) == 0u ? v : -v;
+    return u + (v + v);
+}
+
+int WrapCell(int cell, int cells)
+{
+    if (cells <= 0)
+    {
+        return cell;
+    }
+    int c = cell % cells;
+    return c < 0 ? c + cells : c;
+}
+
+void LatticeCoord(int position, int p, out int cell, out float frac)
+{
+    cell = position >= 0 ? position / p : -((-position + p - 1) / p);
+    frac = float(position - cell * p) / float(p);
+}
+
+void main()
+{
+    ivec2 position = origin + ivec2(gl_FragCoord.xy);
+    float noise = 0.0;
+
+    for (int o = 0; o < octaves; o++)
+    {
+        int cells = wrap > 0 ? max(1, wrap / pitch[o]) : 0;
+
+        int cellX, cellY;
+        float fracX, fracY;
+        LatticeCoord(position.x, pitch[o], cellX, fracX);
+        LatticeCoord(position.y, pitch[o], cellY, fracY);
+
+        int x0 = WrapCell(cellX, cells);
+        int x1 = WrapCell(cellX + 1, cells);
+        int y0 = WrapCell(cellY, cells);
+        int y1 = WrapCell(cellY + 1, cells);
+
+        float g00 = Grad(Hash(octaveSeed[o], x0, y0), fracX, fracY);
+        float g10 = Grad(Hash(octaveSeed[o], x1, y0), fracX - 1.0, fracY);
+        float g01 = Grad(Hash(octaveSeed[o], x0, y1), fracX, fracY - 1.0);
+        float g11 = Grad(Hash(octaveSeed[o], x1, y1), fracX - 1.0, fracY - 1.0);
+
+        float fadeX = Fade(fracX);
+        float fadeY = Fade(fracY);
+        float value = mix(mix(g00, g10, fadeX), mix(g01, g11, fadeX), fadeY);
+
+        noise += value * octaveScale[o];
+    }
+
+    height = (noise / scaleAcc) * amplitude + 0.5;
+}
@@ -0,0 +1,11 @@
+#version 420 core
+
+/*
+* Draws a single triangle that covers the whole viewport. The positions are
+* derived from the vertex id, so no vertex buffer is needed.
+*/
+void main()
+{
+    vec2 position = vec2(float((gl_VertexID & 1) << 2), float((gl_VertexID & 2) << 1)) - 1.0;
+    gl_Position = vec4(position, 0.0, 1.0);
+}
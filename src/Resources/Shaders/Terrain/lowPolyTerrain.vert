@@ -1,29 +1,87 @@
-#version 420 core
-
-layout (location = 0) in vec3 aPosition;
-layout (location = 1) in vec3 aNormal;
-layout (location = 2) in vec3 aColor;
-
-layout (std140, binding = 0) uniform Matrices
-{
-    mat4 projection;
-    mat4 view;
-    mat4 view3;
-};
-
-out VS_OUT
-{
-    vec3 fragPos;
-    vec3 fragNormal;
-    vec3 fragColor;
-} vs_out;
-
-uniform mat4 model;
-
-void main()
-{
-    vs_out.fragColor = aColor;
-    vs_out.fragNormal = aNormal;
-    vs_out.fragPos = vec3(model * vec4(aPosition, 1.0));
-    gl_Position = projection * view * model * vec4(aPosition, 1.0);
-}
+#version 420 core
+
+layout (location = 0) in vec4 aPosition;
+layout (location = 1) in vec2 aNormal1;
+layout (location = 2) in vec2 aNormal2;
+layout (location = 4) in vec2 aMorphNormal1;
+layout (location = 5) in vec2 aMorphNormal2;
+
+layout (std140, binding = 0) uniform Matrices
+{
+    mat4 projection;
+    mat4 view;
+    mat4 view3;
+};
+
+layout (std140, binding = 1) uniform Camera
+{
+    vec3 cameraPos;
+};
+
+/*
+* The normals are flat, so the fragment shader sees the values of the
+* provoking vertex, which carries the normals of both triangles of its quad.
+* Its world height picks the color of the quad.
+*/
+out VS_OUT
+{
+    vec3 fragPos;
+    flat vec3 fragNormal1;
+    flat vec3 fragNormal2;
+    flat float fragHeight;
+    flat float fragOcclusion;
+} vs_out;
+
+/*
+* The position is normalized to the terrain bounds, model maps it to world space.
+* aPosition.w is the height of the next coarser LOD level at this grid point, the
+* vertex morphs to it between morphRange.x and morphRange.y from the camera.
+*/
+uniform mat4 model;
+uniform vec2 morphRange;
+
+/*
+* Baked ambient occlusion of the terrain grid (see Terrain::Draw), looked up
+* at the world x and z of the vertex. The streamed terrain sets no
+* occlusionTransform and stays unoccluded.
+*/
+uniform sampler2D ambientOcclusion;
+uniform vec4 occlusionTransform;
+
+vec3 OctDecode(vec2 oct);
+float Occlusion(vec3 worldPos);
+
+void main()
+{
+    float distanceToCamera = distance(vec3(model * vec4(aPosition.xyz, 1.0)), cameraPos);
+    float morph = clamp((distanceToCamera - morphRange.x) / (morphRange.y - morphRange.x), 0.0, 1.0);
+    vec3 position = vec3(aPosition.x, mix(aPosition.y, aPosition.w, morph), aPosition.z);
+
+    vs_out.fragNormal1 = normalize(mix(OctDecode(aNormal1), OctDecode(aMorphNormal1), morph));
+    vs_out.fragNormal2 = normalize(mix(OctDecode(aNormal2), OctDecode(aMorphNormal2), morph));
+    vs_out.fragPos = vec3(model * vec4(position, 1.0));
+    vs_out.fragHeight = vs_out.fragPos.y;
+    vs_out.fragOcclusion = Occlusion(vs_out.fragPos);
+    gl_Position = projection * view * model * vec4(position, 1.0);
+}
+
+vec3 OctDecode(vec2 oct)
+{
+    /*
+    * Octahedron encoding around +y, the lower half is folded over the diagonals.
+    */
+    vec3 n = vec3(oct.x, 1.0 - abs(oct.x) - abs(oct.y), oct.y);
+    float t = max(-n.y, 0.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.z += n.z >= 0.0 ? -t : t;
+    return normalize(n);
+}
+
+float Occlusion(vec3 worldPos)
+{
+    if (occlusionTransform.x == 0.0)
+    {
+        return 1.0;
+    }
+    return texture(ambientOcclusion, worldPos.zx * occlusionTransform.xy + occlusionTransform.zw).r;
+}
@@ -0,0 +1,158 @@
+#version 420 core
+
+layout (location = 0) in uvec2 aGrid;
+layout (location = 1) in vec4 aInstance;
+
+layout (std140, binding = 0) uniform Matrices
+{
+    mat4 projection;
+    mat4 view;
+    mat4 view3;
+};
+
+layout (std140, binding = 1) uniform Camera
+{
+    vec3 cameraPos;
+};
+
+/*
+* Same outputs as lowPolyTerrain.vert, so both share lowPolyTerrain.frag.
+*/
+out VS_OUT
+{
+    vec3 fragPos;
+    flat vec3 fragNormal1;
+    flat vec3 fragNormal2;
+    flat float fragHeight;
+    flat float fragOcclusion;
+} vs_out;
+
+/*
+* aGrid is the grid point within the patch. aInstance holds the level 0 grid point
+* of the patch corner (xy), the grid step of its level (z) and the level (w).
+* Grid point (i, j) is texel (j, i) of heightMap and lies at
+* (i * gridSpacing, height, j * gridSpacing) before model.
+*/
+uniform mat4 model;
+uniform sampler2D heightMap;
+uniform int gridSize;
+uniform float gridSpacing;
+uniform int levelCount;
+uniform vec2 morphRanges[16];
+
+/*
+* Baked ambient occlusion of the terrain grid (see Terrain::Draw), looked up
+* at the world x and z of the vertex. The streamed terrain sets no
+* occlusionTransform and stays unoccluded.
+*/
+uniform sampler2D ambientOcclusion;
+uniform vec4 occlusionTransform;
+
+ivec2 GridPoint(ivec2 patchPoint);
+float Height(ivec2 gridPoint);
+vec3 MorphedPosition(ivec2 patchPoint);
+vec3 TriangleNormal(vec3 v0, vec3 v1, vec3 v2);
+float Occlusion(vec3 worldPos);
+
+void main()
+{
+    /*
+    * This vertex is q1 of the quad to its lower j side, the provoking vertex of
+    * both its triangles (see TerrainLod::buildInstancedPatch). The flat normals
+    * are those of the morphed quad, so they always match the drawn triangles.
+    * For the vertices that are no q1 they are computed but never used.
+    */
+    ivec2 v = ivec2(aGrid);
+    vec3 q0 = MorphedPosition(v + ivec2(0, -1));
+    vec3 q1 = MorphedPosition(v);
+    vec3 q2 = MorphedPosition(v + ivec2(1, -1));
+    vec3 q3 = MorphedPosition(v + ivec2(1, 0));
+
+    vs_out.fragNormal1 = TriangleNormal(q0, q1, q2);
+    vs_out.fragNormal2 = TriangleNormal(q2, q1, q3);
+    vs_out.fragPos = vec3(model * vec4(q1, 1.0));
+    vs_out.fragHeight = vs_out.fragPos.y;
+    vs_out.fragOcclusion = Occlusion(vs_out.fragPos);
+    gl_Position = projection * view * model * vec4(q1, 1.0);
+}
+
+ivec2 GridPoint(ivec2 patchPoint)
+{
+    /*
+    * The quadtree is padded to a power of two, the padding collapses onto the
+    * last grid point like in the level grids of the vertex buffer mode.
+    */
+    ivec2 point = ivec2(aInstance.xy) + max(patchPoint, ivec2(0)) * int(aInstance.z);
+    return min(point, ivec2(gridSize - 1));
+}
+
+float Height(ivec2 gridPoint)
+{
+    return texelFetch(heightMap, gridPoint.yx, 0).r;
+}
+
+vec3 MorphedPosition(ivec2 patchPoint)
+{
+    ivec2 point = GridPoint(patchPoint);
+    vec3 position = vec3(float(point.x) * gridSpacing, Height(point), float(point.y) * gridSpacing);
+
+    int level = int(aInstance.w);
+    if (level + 1 >= levelCount)
+    {
+        return position;
+    }
+
+    /*
+    * The morph target is the height of the coarser level, interpolated on the
+    * edge of the coarse triangle this point lies on. Points shared with the
+    * coarse grid keep their height. The coarse quads are split along the same
+    * diagonal as the fine ones, from (i - 1, j + 1) to (i + 1, j - 1).
+    */
+    ivec2 odd = patchPoint & 1;
+    ivec2 a = patchPoint;
+    ivec2 b = patchPoint;
+    if (odd.x == 1 && odd.y == 1)
+    {
+        a += ivec2(-1, 1);
+        b += ivec2(1, -1);
+    }
+    else if (odd.x == 1)
+    {
+        a.x -= 1;
+        b.x += 1;
+    }
+    else if (odd.y == 1)
+    {
+        a.y -= 1;
+        b.y += 1;
+    }
+    float coarseHeight = 0.5 * (Height(GridPoint(a)) + Height(GridPoint(b)));
+
+    vec2 range = morphRanges[level];
+    float distanceToCamera = distance(vec3(model * vec4(position, 1.0)), cameraPos);
+    float morph = clamp((distanceToCamera - range.x) / (range.y - range.x), 0.0, 1.0);
+    position.y = mix(position.y, coarseHeight, morph);
+    return position;
+}
+
+vec3 TriangleNormal(vec3 v0, vec3 v1, vec3 v2)
+{
+    /*
+    * Quads in the padding collapse to lines and get an up facing normal.
+    */
+    vec3 normal = cross(v2 - v1, v0 - v1);
+    if (dot(normal, normal) <= 1e-20)
+    {
+        return vec3(0.0, 1.0, 0.0);
+    }
+    return normalize(normal);
+}
+
+float Occlusion(vec3 worldPos)
+{
+    if (occlusionTransform.x == 0.0)
+    {
+        return 1.0;
+    }
+    return texture(ambientOcclusion, worldPos.zx * occlusionTransform.xy + occlusionTransform.zw).r;
+}
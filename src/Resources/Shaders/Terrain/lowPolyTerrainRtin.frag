@@ -0,0 +1,118 @@
+#version 420 core
+
+out vec4 glFragColor;
+
+struct DirectionalLight
+{
+    /*
+    * Directional light imitates the sun. The sun is so 
+    * far away that it is omnipresent from a specific
+    * direction. 
+    */
+    vec3 direction;
+
+    /*
+    * The three light components of the Phong lighting model
+    */
+    vec3 ambient;
+    vec3 diffuse;
+    vec3 specular;
+};
+
+layout (std140, binding = 1) uniform Camera
+{
+    vec3 cameraPos;
+};
+
+layout (std140, binding = 2) uniform WorldLight
+{
+    vec3 direction;
+};
+
+layout (std140, binding = 3) uniform TerrainPalette
+{
+    /*
+    * rgb, 0 to 4 are the height bands from the valleys up, 5 is
+    * blended in on steep slopes (see GameWorld::setupTerrainPalette).
+    */
+    vec4 biomeColors[6];
+
+    /*
+    * Unit heights at which the bands 1 to 4 begin.
+    */
+    vec4 biomeHeights;
+
+    /*
+    * x: world height of unit height 1, y: half width of the blend
+    * between two bands in unit heights, z and w: slope (1 - normal.y)
+    * at which the steep color starts and at which it is complete.
+    */
+    vec4 biomeParams;
+};
+
+in VS_OUT
+{
+    vec3 fragPos;
+    vec3 fragUnitPos;
+    flat float fragHeight;
+    flat float fragOcclusion;
+} fs_in;
+
+vec3 CalculateDirectionalPhong(DirectionalLight light, vec3 fragPos, vec3 fragNormal, vec3 fragColor, vec3 cameraPos);
+vec3 CalculateDirectionalBlinnPhong();
+vec3 BiomeColor(float worldHeight, vec3 worldNormal);
+
+DirectionalLight light_1;
+const float SHININESS = 8.0;
+
+void main()
+{
+    light_1.direction = direction;
+    light_1.ambient = vec3(0.25, 0.25, 0.25) * fs_in.fragOcclusion;
+    light_1.diffuse = vec3(1.0, 1.0, 1.0);
+    light_1.specular = vec3(0.0, 0.0, 0.0);
+
+    // fragUnitPos is linear across a triangle, so its derivatives span the triangle plane. The
+    // mesh is wound counter-clockwise from above, the cross product points up on front faces.
+    vec3 fragNormal = cross(dFdx(fs_in.fragUnitPos), dFdy(fs_in.fragUnitPos));
+
+    // The slope of the biome is the one in the world.
+    vec3 worldNormal = normalize(cross(dFdx(fs_in.fragPos), dFdy(fs_in.fragPos)));
+    vec3 biomeColor = BiomeColor(fs_in.fragHeight, worldNormal);
+
+    vec3 fragColor = CalculateDirectionalPhong(light_1, fs_in.fragPos, fragNormal, biomeColor, cameraPos);
+    // gl_FragColor = vec4(fragColor, 1.0);
+    glFragColor = vec4(fragColor, 1.0);
+}
+
+vec3 CalculateDirectionalPhong(DirectionalLight light, vec3 fragPos, vec3 fragNormal, vec3 fragColor, vec3 cameraPos)
+{
+    vec3 kA = light.ambient;
+    vec3 kD = light.diffuse;
+//	vec3 kS = light.specular;
+    
+    vec3 N = normalize(fragNormal);
+    vec3 L = normalize(-light.direction);
+//	vec3 R = reflect(N, light.direction);
+//	vec3 V = cameraPos;
+
+    vec3 ambientC = kA * vec3(fragColor);
+    vec3 diffuseC = kD * max(dot(L, N), 0.0) * vec3(fragColor);
+//	vec3 specularC = kS * pow(max(dot(R, V), 0.0), 1) * vec3(fragColor);
+
+    return ambientC + diffuseC;
+}
+
+vec3 BiomeColor(float worldHeight, vec3 worldNormal)
+{
+    float height = worldHeight / biomeParams.x;
+    vec3 color = biomeColors[0].rgb;
+    for (int band = 0; band < 4; band++)
+    {
+        float t = smoothstep(biomeHeights[band] - biomeParams.y, biomeHeights[band] + biomeParams.y, height);
+        color = mix(color, biomeColors[band + 1].rgb, t);
+    }
+
+    float slope = 1.0 - abs(worldNormal.y);
+    return mix(color, biomeColors[5].rgb, smoothstep(biomeParams.z, biomeParams.w, slope));
+}
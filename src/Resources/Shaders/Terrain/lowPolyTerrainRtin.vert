@@ -0,0 +1,59 @@
+#version 420 core
+
+layout (location = 0) in vec4 aPosition;
+
+layout (std140, binding = 0) uniform Matrices
+{
+    mat4 projection;
+    mat4 view;
+    mat4 view3;
+};
+
+/*
+* No normals are passed on, the fragment shader derives the flat
+* normal of each triangle from fragUnitPos. Like the normals of the
+* other terrain meshes it is taken before the world transform. The
+* world height of the provoking vertex picks the color of the triangle.
+*/
+out VS_OUT
+{
+    vec3 fragPos;
+    vec3 fragUnitPos;
+    flat float fragHeight;
+    flat float fragOcclusion;
+} vs_out;
+
+/*
+* The position is normalized to the terrain bounds, unitModel maps it to
+* the unit terrain and model from there to world space.
+*/
+uniform mat4 model;
+uniform mat4 unitModel;
+
+/*
+* Baked ambient occlusion of the terrain grid (see Terrain::Draw), looked up
+* at the world x and z of the vertex. The streamed terrain sets no
+* occlusionTransform and stays unoccluded.
+*/
+uniform sampler2D ambientOcclusion;
+uniform vec4 occlusionTransform;
+
+float Occlusion(vec3 worldPos);
+
+void main()
+{
+    vs_out.fragUnitPos = vec3(unitModel * vec4(aPosition.xyz, 1.0));
+    vs_out.fragPos = vec3(model * vec4(vs_out.fragUnitPos, 1.0));
+    vs_out.fragHeight = vs_out.fragPos.y;
+    vs_out.fragOcclusion = Occlusion(vs_out.fragPos);
+    gl_Position = projection * view * vec4(vs_out.fragPos, 1.0);
+}
+
+float Occlusion(vec3 worldPos)
+{
+    if (occlusionTransform.x == 0.0)
+    {
+        return 1.0;
+    }
+    return texture(ambientOcclusion, worldPos.zx * occlusionTransform.xy + occlusionTransform.zw).r;
+}
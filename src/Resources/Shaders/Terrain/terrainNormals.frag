@@ -1,15 +1,15 @@
-#version 420 core
-
-out vec4 glFragColor;
-
-//in vec2 TexCoords;
-
-//uniform sampler2D texture_diffuse_1;
-//uniform sampler2D texture_specular_1;
-//uniform sampler2D texture_normal_1;
-
-void main()
-{
-    // gl_FragColor = vec4(1.0, 1.0, 0.0, 1.0);
-    glFragColor = vec4(1.0, 1.0, 0.0, 1.0);
-}
+#version 420 core
+
+out vec4 glFragColor;
+
+//in vec2 TexCoords;
+
+//uniform sampler2D texture_diffuse_1;
+//uniform sampler2D texture_specular_1;
+//uniform sampler2D texture_normal_1;
+
+void main()
+{
+    // gl_FragColor = vec4(1.0, 1.0, 0.0, 1.0);
+    glFragColor = vec4(1.0, 1.0, 0.0, 1.0);
+}
@@ -0,0 +1,68 @@
+#include "Terrain/AmbientOcclusion.h"
+
+// The horizon search distances in samples, dense close to the sample where the horizon
+// usually is and sparse farther out.
+//
+const uint32_t AmbientOcclusion::_STEPS_[] = {1, 2, 3, 4, 6, 8, 12, 16, 24, 32};
+const uint32_t AmbientOcclusion::_STEP_COUNT_ = sizeof(_STEPS_) / sizeof(_STEPS_[0]);
+const uint32_t AmbientOcclusion::_REACH_ = 32;
+
+// Like the row bands of TerrainGenerator.
+//
+const uint32_t AmbientOcclusion::_ROWS_PER_TASK_ = 16;
+
+void AmbientOcclusion::Bake(const Heightfield &_heightfield,
+                            const float _relief,
+                            const uint32_t _i,
+                            const uint32_t _j,
+                            const uint32_t _rows,
+                            const uint32_t _cols,
+                            uint8_t *occlusion)
+{
+    Parallel::For(0, _rows, _ROWS_PER_TASK_, [&](uint32_t row_begin, uint32_t row_end) {
+        for (uint32_t i = row_begin; i < row_end; i++)
+        {
+            uint8_t *row = occlusion + (std::size_t)i * _cols;
+            for (uint32_t j = 0; j < _cols; j++)
+            {
+                row[j] = bakeSample(_heightfield, _relief, (int)(_i + i), (int)(_j + j));
+            }
+        }
+    });
+}
+
+uint8_t AmbientOcclusion::bakeSample(const Heightfield &_heightfield,
+                                     const float _relief,
+                                     const int _i,
+                                     const int _j)
+{
+    static const int directions[8][2] = {
+        {1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}, {-1, -1}, {0, -1}, {1, -1}};
+    const int rows = (int)_heightfield.GetRows();
+    const int cols = (int)_heightfield.GetCols();
+    const float height = _heightfield.At((uint32_t)_i, (uint32_t)_j);
+
+    float occluded = 0.0f;
+    for (int d = 0; d < 8; d++)
+    {
+        // The horizon is the steepest slope towards any sample in this direction, the map
+        // edge is open.
+        //
+        const float spacing = (d & 1) ? 1.41421356f : 1.0f;
+        float horizon = 0.0f;
+        for (uint32_t s = 0; s < _STEP_COUNT_; s++)
+        {
+            const int i = _i + directions[d][0] * (int)_STEPS_[s];
+            const int j = _j + directions[d][1] * (int)_STEPS_[s];
+            if (i < 0 || j < 0 || i >= rows || j >= cols)
+            {
+                break;
+            }
+            const float rise = _heightfield.At((uint32_t)i, (uint32_t)j) - height;
+            horizon = std::max(horizon, rise / (spacing * (float)_STEPS_[s]));
+        }
+        horizon *= _relief;
+        occluded += horizon / std::sqrt(1.0f + horizon * horizon);
+    }
+    return (uint8_t)std::lround(255.0f * (1.0f - occluded / 8.0f));
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "Application/Parallel.h"
+#include "Terrain/Heightfield.h"
+
+// Horizon based ambient occlusion of a heightfield, baked per sample on the CPU.
+//
+// From every sample the horizon is searched along the 8 grid directions, the axes and the
+// diagonals, at distances growing from 1 to _REACH_ samples, so every lookup is a grid sample
+// and no interpolation is needed. The occlusion of a direction is the sine of its horizon
+// angle, a horizon below the sample does not occlude. The result is one minus their mean,
+// stored as 8 bits, 255 for an open sky.
+//
+// The rows are baked on all cores. Samples only read the heightfield, so the result does not
+// depend on the thread count.
+//
+class AmbientOcclusion
+{
+public:
+    // Bakes the samples [_i, _i + _rows) x [_j, _j + _cols) into occlusion, row by row with a
+    // pitch of _cols. _relief is the world height of height 1 over the world distance of two
+    // neighbouring samples.
+    //
+    static void Bake(const Heightfield &_heightfield,
+                     const float _relief,
+                     const uint32_t _i,
+                     const uint32_t _j,
+                     const uint32_t _rows,
+                     const uint32_t _cols,
+                     uint8_t *occlusion);
+
+    // Farthest sample that can occlude another, in samples along a grid axis. Changing a
+    // height only changes the occlusion of the samples within it.
+    //
+    static uint32_t GetReach();
+
+private:
+    static const uint32_t _REACH_;
+    static const uint32_t _STEP_COUNT_;
+    static const uint32_t _STEPS_[];
+    static const uint32_t _ROWS_PER_TASK_;
+
+    AmbientOcclusion();
+
+    static uint8_t bakeSample(const Heightfield &_heightfield,
+                              const float _relief,
+                              const int _i,
+                              const int _j);
+};
+
+inline uint32_t AmbientOcclusion::GetReach() { return _REACH_; }
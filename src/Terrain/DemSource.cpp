@@ -0,0 +1,172 @@
+#include "Terrain/DemSource.h"
+
+// Converted PNGs, next to the world snapshots.
+//
+const char *DemSource::_CACHE_DIRECTORY_ = "cache";
+
+DemSource::DemSource(const std::string &_path,
+                     const DEMFORMATenum _format,
+                     const uint32_t _rows,
+                     const uint32_t _cols)
+    : rows_(0), cols_(0), is_big_endian_(_format == DEMFORMATenum::RAW16_BE)
+{
+    if (_format != DEMFORMATenum::PNG16)
+    {
+        openRaw(_path, _rows, _cols);
+        return;
+    }
+
+    uint32_t rows, cols;
+    std::string raw_path = convertPng(_path, rows, cols);
+    if (!raw_path.empty())
+    {
+        openRaw(raw_path, rows, cols);
+    }
+}
+
+void DemSource::ReadTile(const int64_t _row,
+                         const int64_t _col,
+                         const uint32_t _rows,
+                         const uint32_t _cols,
+                         float *heights) const
+{
+    if (!IsOpen())
+    {
+        std::fill(heights, heights + (std::size_t)_rows * _cols, 0.0f);
+        return;
+    }
+
+    // The columns inside of the grid are one contiguous run of every row, the ones outside
+    // repeat the first or the last sample of the row.
+    //
+    const int64_t last_col = (int64_t)cols_ - 1;
+    const uint32_t inside_begin = (uint32_t)std::clamp<int64_t>(-_col, 0, _cols);
+    const uint32_t inside_end =
+        (uint32_t)std::clamp<int64_t>(last_col + 1 - _col, inside_begin, _cols);
+    const int hi = is_big_endian_ ? 0 : 1;
+    const float scale = 1.0f / 65535.0f;
+    for (uint32_t i = 0; i < _rows; i++)
+    {
+        const int64_t row = std::clamp<int64_t>(_row + i, 0, (int64_t)rows_ - 1);
+        const uint8_t *samples = file_.GetData() + (std::size_t)row * cols_ * 2;
+        float *out = heights + (std::size_t)i * _cols;
+
+        for (uint32_t j = inside_begin; j < inside_end; j++)
+        {
+            const uint8_t *sample = samples + (std::size_t)(_col + j) * 2;
+            out[j] = (float)((uint32_t)sample[hi] << 8 | sample[1 - hi]) * scale;
+        }
+        const float first = (float)((uint32_t)samples[hi] << 8 | samples[1 - hi]) * scale;
+        const uint8_t *last_sample = samples + (std::size_t)last_col * 2;
+        const float last = (float)((uint32_t)last_sample[hi] << 8 | last_sample[1 - hi]) * scale;
+        std::fill(out, out + inside_begin, first);
+        std::fill(out + inside_end, out + _cols, last);
+    }
+}
+
+bool DemSource::openRaw(const std::string &_path, const uint32_t _rows, const uint32_t _cols)
+{
+    if (!file_.Open(_path))
+    {
+        std::cout << "ERROR::DEMSOURCE::OPEN_RAW::CANNOT_MAP " << _path << std::endl;
+        return false;
+    }
+
+    const uint64_t samples = file_.GetSize() / 2;
+    rows_ = _rows;
+    cols_ = _cols;
+    if (rows_ == 0 || cols_ == 0)
+    {
+        rows_ = cols_ = (uint32_t)std::llround(std::sqrt((double)samples));
+    }
+    if (rows_ == 0 || (uint64_t)rows_ * cols_ > samples)
+    {
+        std::cout << "ERROR::DEMSOURCE::OPEN_RAW::SIZE_MISMATCH " << _path << std::endl;
+        file_.Close();
+        rows_ = cols_ = 0;
+        return false;
+    }
+
+    // Tiles touch a few rows scattered over the file, reading ahead along a row only loads
+    // samples of other tiles.
+    //
+    file_.AdviseRandomAccess();
+    return true;
+}
+
+std::string DemSource::convertPng(const std::string &_path, uint32_t &rows, uint32_t &cols)
+{
+    // stb_image decodes into one buffer of at most INT_MAX bytes, the 16 bit rows with a
+    // filter byte each, and refuses larger images as not an image at all. So the size is read
+    // from the IHDR chunk first, which holds the big endian width and height from byte 16 on,
+    // then the bit depth and the color type.
+    //
+    uint8_t ihdr[26] = {};
+    std::ifstream png(_path, std::ios::binary);
+    png.read((char *)ihdr, sizeof(ihdr));
+    if (png && ihdr[1] == 'P' && ihdr[2] == 'N' && ihdr[3] == 'G')
+    {
+        const int channels[7] = {1, 1, 3, 1, 2, 1, 4};
+        const uint64_t png_cols =
+            (uint64_t)ihdr[16] << 24 | ihdr[17] << 16 | ihdr[18] << 8 | ihdr[19];
+        const uint64_t png_rows =
+            (uint64_t)ihdr[20] << 24 | ihdr[21] << 16 | ihdr[22] << 8 | ihdr[23];
+        const uint64_t png_channels = ihdr[25] < 7 ? channels[ihdr[25]] : 1;
+        if ((png_cols * png_channels * 2 + 1) * png_rows > (uint64_t)INT_MAX)
+        {
+            std::cout << "ERROR::DEMSOURCE::CONVERT_PNG::TOO_LARGE_CONVERT_TO_RAW " << _path << " "
+                      << png_cols << "x" << png_rows << std::endl;
+            return std::string();
+        }
+    }
+
+    int width, height, n_comp;
+    if (!stbi_info(_path.c_str(), &width, &height, &n_comp) || !stbi_is_16_bit(_path.c_str()))
+    {
+        std::cout << "ERROR::DEMSOURCE::CONVERT_PNG::NOT_A_16_BIT_IMAGE " << _path << std::endl;
+        return std::string();
+    }
+    rows = (uint32_t)height;
+    cols = (uint32_t)width;
+
+    std::error_code error;
+    std::filesystem::create_directories(_CACHE_DIRECTORY_, error);
+    const std::string raw_path = std::string(_CACHE_DIRECTORY_) + "/" +
+                                 std::filesystem::path(_path).filename().string() + ".raw";
+    if (std::filesystem::exists(raw_path, error) &&
+        std::filesystem::last_write_time(raw_path, error) >=
+            std::filesystem::last_write_time(_path, error))
+    {
+        return raw_path;
+    }
+
+    // Only the first channel of a color image is used.
+    //
+    uint16_t *data = stbi_load_16(_path.c_str(), &width, &height, &n_comp, 1);
+    if (data == nullptr)
+    {
+        std::cout << "ERROR::DEMSOURCE::CONVERT_PNG::DECODE_FAILED " << _path << std::endl;
+        return std::string();
+    }
+    std::vector<uint8_t> row((std::size_t)width * 2);
+    std::ofstream file(raw_path, std::ios::binary | std::ios::trunc);
+    for (int i = 0; i < height && file; i++)
+    {
+        for (int j = 0; j < width; j++)
+        {
+            const uint16_t sample = data[(std::size_t)i * width + j];
+            row[2 * j] = (uint8_t)(sample & 0xff);
+            row[2 * j + 1] = (uint8_t)(sample >> 8);
+        }
+        file.write((const char *)row.data(), (std::streamsize)row.size());
+    }
+    stbi_image_free(data);
+    if (!file)
+    {
+        std::cout << "ERROR::DEMSOURCE::CONVERT_PNG::WRITE_FAILED " << raw_path << std::endl;
+        file.close();
+        std::filesystem::remove(raw_path, error);
+        return std::string();
+    }
+    return raw_path;
+}
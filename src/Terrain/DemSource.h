@@ -0,0 +1,72 @@
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <stb/stb_image.h>
+
+#include "Application/MappedFile.h"
+#include "Types/EDem.h"
+
+// Elevation data from a file of 16 bit samples, read a tile at a time.
+//
+// RAW files are headerless grids of 16 bit samples, row by row, in either byte order. They are
+// mapped and never read as a whole, ReadTile only touches the rows of the tile, so grids of
+// tens of thousands of samples per side cost address space, not memory. Without explicit
+// dimensions the grid is assumed to be square.
+//
+// A PNG is compressed as one stream and has to be decoded whole, so a 16 bit greyscale PNG is
+// converted once to a little endian RAW file in cache/ and that is mapped instead. The
+// conversion is skipped while the RAW file is newer than the PNG. stb_image decodes into one
+// buffer of at most INT_MAX bytes, which limits a greyscale PNG to about 32767 samples per
+// side, larger grids have to be given as RAW files.
+//
+// Sample (row, col) decodes to the unit height code / 65535. Reads are const and may run on
+// any number of threads.
+//
+class DemSource
+{
+public:
+    DemSource(const std::string &_path,
+              const DEMFORMATenum _format = DEMFORMATenum::RAW16_LE,
+              const uint32_t _rows = 0,
+              const uint32_t _cols = 0);
+    DemSource(const DemSource &) = delete;
+    DemSource &operator=(const DemSource &) = delete;
+
+    bool IsOpen() const;
+    uint32_t GetRows() const;
+    uint32_t GetCols() const;
+
+    // Writes the unit heights of rows [_row, _row + _rows) and columns [_col, _col + _cols) to
+    // heights, row by row. Samples outside of the grid repeat its nearest edge sample.
+    //
+    void ReadTile(const int64_t _row,
+                  const int64_t _col,
+                  const uint32_t _rows,
+                  const uint32_t _cols,
+                  float *heights) const;
+
+private:
+    MappedFile file_;
+    uint32_t rows_, cols_;
+    bool is_big_endian_;
+
+    static const char *_CACHE_DIRECTORY_;
+
+    bool openRaw(const std::string &_path, const uint32_t _rows, const uint32_t _cols);
+    std::string convertPng(const std::string &_path, uint32_t &rows, uint32_t &cols);
+};
+
+inline bool DemSource::IsOpen() const { return file_.IsOpen(); }
+
+inline uint32_t DemSource::GetRows() const { return rows_; }
+
+inline uint32_t DemSource::GetCols() const { return cols_; }
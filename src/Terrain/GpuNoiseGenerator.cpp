@@ -0,0 +1,231 @@
+#include "Terrain/GpuNoiseGenerator.h"
+
+// Has to match MAX_OCTAVES in heightMapNoise.frag.
+//
+const int GpuNoiseGenerator::_MAX_OCTAVES_ = 16;
+
+GpuNoiseGenerator::GpuNoiseGenerator(const NoiseGenerator::Settings &_settings,
+                                     const int _width,
+                                     const int _height,
+                                     const int _x,
+                                     const int _y)
+    : _settings_(_settings), _width_(_width), _height_(_height), _x_(_x), _y_(_y),
+      shader_(Shader("src/Resources/Shaders/Terrain/heightMapNoise.vert",
+                     "src/Resources/Shaders/Terrain/heightMapNoise.frag")),
+      texture_(0), fbo_(0), pbo_(0), vao_(0), read_fence_(nullptr)
+{
+    setupTexture();
+    setupFramebuffer();
+    setupUniforms();
+
+    // The vertex shader generates its positions from gl_VertexID, but core profile
+    // still requires a vertex array to be bound when drawing.
+    //
+    glGenVertexArrays(1, &vao_);
+
+    glGenBuffers(1, &pbo_);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo_);
+    glBufferData(GL_PIXEL_PACK_BUFFER,
+                 sizeof(float) * _width_ * _height_,
+                 NULL,
+                 GL_STREAM_READ);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+GpuNoiseGenerator::~GpuNoiseGenerator()
+{
+    if (read_fence_ != nullptr)
+    {
+        glDeleteSync(read_fence_);
+    }
+    glDeleteVertexArrays(1, &vao_);
+    glDeleteBuffers(1, &pbo_);
+    glDeleteFramebuffers(1, &fbo_);
+    glDeleteTextures(1, &texture_);
+    glDeleteProgram(shader_.id_);
+}
+
+void GpuNoiseGenerator::Render()
+{
+    double time = glfwGetTime();
+
+    GLint viewport[4], prev_fbo;
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &prev_fbo);
+    GLboolean depth_test = glIsEnabled(GL_DEPTH_TEST);
+    GLboolean blend = glIsEnabled(GL_BLEND);
+    GLboolean cull_face = glIsEnabled(GL_CULL_FACE);
+
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_BLEND);
+    glDisable(GL_CULL_FACE);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo_);
+    glViewport(0, 0, _width_, _height_);
+    shader_.Use();
+    glBindVertexArray(vao_);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glBindVertexArray(0);
+
+    startReadBack();
+
+    glBindFramebuffer(GL_FRAMEBUFFER, prev_fbo);
+    glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+    if (depth_test) glEnable(GL_DEPTH_TEST);
+    if (blend) glEnable(GL_BLEND);
+    if (cull_face) glEnable(GL_CULL_FACE);
+
+    std::cout << "INFO::GPU_NOISE_GENERATOR::RENDER" << std::endl;
+    std::cout << "Size:" << _width_ << "x" << _height_ << std::endl;
+    std::cout << "Submit took:" << (glfwGetTime() - time) * 1000 << "ms" << std::endl;
+}
+
+bool GpuNoiseGenerator::IsReadBackReady()
+{
+    if (read_fence_ == nullptr)
+    {
+        return false;
+    }
+
+    GLenum status = glClientWaitSync(read_fence_, 0, 0);
+    return status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+}
+
+std::shared_ptr<float[]> GpuNoiseGenerator::ReadBack()
+{
+    if (read_fence_ == nullptr)
+    {
+        Render();
+    }
+
+    // Block until the copy into the pixel buffer has finished. Callers that do not want to
+    // stall can poll IsReadBackReady first.
+    //
+    while (glClientWaitSync(read_fence_, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000) ==
+           GL_TIMEOUT_EXPIRED)
+    {
+    }
+
+    std::size_t count = (std::size_t)_width_ * _height_;
+    std::shared_ptr<float[]> height_map(new float[count]);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo_);
+    const float *mapped = (const float *)glMapBufferRange(GL_PIXEL_PACK_BUFFER,
+                                                          0,
+                                                          sizeof(float) * count,
+                                                          GL_MAP_READ_BIT);
+    if (mapped != nullptr)
+    {
+        std::copy(mapped, mapped + count, height_map.get());
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    else
+    {
+        std::cout << "ERROR::GPU_NOISE_GENERATOR::READ_BACK::MAP_FAILED" << std::endl;
+        std::fill(height_map.get(), height_map.get() + count, 0.0f);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    return height_map;
+}
+
+float GpuNoiseGenerator::Verify(const float _tolerance)
+{
+    std::shared_ptr<float[]> gpu_height_map = ReadBack();
+    std::shared_ptr<float[]> cpu_height_map(new float[(std::size_t)_width_ * _height_]);
+    NoiseGenerator::PerlinNoise2DTile(_settings_,
+                                      _x_,
+                                      _y_,
+                                      _width_,
+                                      _height_,
+                                      cpu_height_map.get());
+
+    float max_error = 0.0f;
+    for (std::size_t i = 0; i < (std::size_t)_width_ * _height_; i++)
+    {
+        max_error = std::max(max_error, std::abs(gpu_height_map[i] - cpu_height_map[i]));
+    }
+
+    if (max_error > _tolerance)
+    {
+        std::cout << "ERROR::GPU_NOISE_GENERATOR::VERIFY::TOLERANCE_EXCEEDED" << std::endl;
+    }
+    else
+    {
+        std::cout << "INFO::GPU_NOISE_GENERATOR::VERIFY::OK" << std::endl;
+    }
+    std::cout << "Max error:" << max_error << "|Tolerance:" << _tolerance << std::endl;
+
+    return max_error;
+}
+
+uint32_t GpuNoiseGenerator::GetTexture() { return texture_; }
+
+void GpuNoiseGenerator::setupTexture()
+{
+    glGenTextures(1, &texture_);
+    glBindTexture(GL_TEXTURE_2D, texture_);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_R32F, _width_, _height_);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void GpuNoiseGenerator::setupFramebuffer()
+{
+    glGenFramebuffers(1, &fbo_);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo_);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture_, 0);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    {
+        std::cout << "ERROR::GPU_NOISE_GENERATOR::SETUP_FRAMEBUFFER::INCOMPLETE" << std::endl;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void GpuNoiseGenerator::setupUniforms()
+{
+    int count = std::min(NoiseGenerator::CountOctaves(_settings_), _MAX_OCTAVES_);
+
+    shader_.Use();
+    shader_.SetIVec2("origin", glm::ivec2(_x_, _y_));
+    shader_.SetInt("octaves", count);
+    shader_.SetInt("wrap", _settings_.wrap);
+    shader_.SetFloat("amplitude", NoiseGenerator::GetAmplitude());
+
+    // Octave weights are accumulated in the same order as on the CPU.
+    //
+    float scale = 1.0f;
+    float scale_acc = 0.0f;
+    for (int o = 0; o < count; o++)
+    {
+        std::string index = "[" + std::to_string(o) + "]";
+        shader_.SetInt("pitch" + index, _settings_.pitch >> o);
+        shader_.SetUInt("octaveSeed" + index, NoiseGenerator::OctaveSeed(_settings_.seed, o));
+        shader_.SetFloat("octaveScale" + index, scale);
+        scale_acc += scale;
+        scale = scale / _settings_.bias;
+    }
+    shader_.SetFloat("scaleAcc", scale_acc);
+}
+
+void GpuNoiseGenerator::startReadBack()
+{
+    if (read_fence_ != nullptr)
+    {
+        glDeleteSync(read_fence_);
+    }
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo_);
+    glReadBuffer(GL_COLOR_ATTACHMENT0);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo_);
+    glReadPixels(0, 0, _width_, _height_, GL_RED, GL_FLOAT, (void *)0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    read_fence_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+}
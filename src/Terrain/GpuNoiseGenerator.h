@@ -0,0 +1,55 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "Renderer/Shader.h"
+#include "Terrain/NoiseGenerator.h"
+
+// Renders the same fractal noise as NoiseGenerator into an R32F texture, one fragment per
+// height map sample. Only needs GL 4.2 (no compute shaders). The result can either stay on
+// the GPU as a texture or be read back asynchronously through a pixel buffer.
+//
+class GpuNoiseGenerator
+{
+public:
+    GpuNoiseGenerator(const NoiseGenerator::Settings &_settings,
+                      const int _width,
+                      const int _height,
+                      const int _x = 0,
+                      const int _y = 0);
+    GpuNoiseGenerator(const GpuNoiseGenerator &) = delete;
+    GpuNoiseGenerator &operator=(const GpuNoiseGenerator &) = delete;
+    ~GpuNoiseGenerator();
+
+    void Render();
+    bool IsReadBackReady();
+    std::shared_ptr<float[]> ReadBack();
+    float Verify(const float _tolerance = 1e-4f);
+
+    uint32_t GetTexture();
+
+private:
+    const NoiseGenerator::Settings _settings_;
+    const int _width_;
+    const int _height_;
+    const int _x_;
+    const int _y_;
+
+    Shader shader_;
+    uint32_t texture_, fbo_, pbo_, vao_;
+    GLsync read_fence_;
+
+    static const int _MAX_OCTAVES_;
+
+    void setupTexture();
+    void setupFramebuffer();
+    void setupUniforms();
+    void startReadBack();
+};
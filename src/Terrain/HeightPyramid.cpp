@@ -0,0 +1,418 @@
+#include "Terrain/HeightPyramid.h"
+
+// Batches of at least this many queries are spread over all cores, smaller ones are not worth
+// starting the threads for.
+//
+const std::size_t HeightPyramid::_PARALLEL_BATCH_ = 1024;
+
+HeightPyramid::HeightPyramid(std::shared_ptr<const Heightfield> _heightfield,
+                             const glm::vec2 &_scale,
+                             const glm::vec2 &_offset)
+    : heightfield_(_heightfield), _scale_(_scale), _offset_(_offset)
+{
+    buildLevels();
+}
+
+bool HeightPyramid::Raycast(const glm::vec3 &_origin,
+                            const glm::vec3 &_direction,
+                            const float _max_distance,
+                            float &distance) const
+{
+    const float length = glm::length(_direction);
+    if (length <= std::numeric_limits<float>::min() || levels_.empty())
+    {
+        return false;
+    }
+
+    // The map from world to grid space is affine, so the ray parameter is the same in both.
+    //
+    glm::vec3 origin(_origin.x * _scale_.x + _offset_.x,
+                     _origin.y,
+                     _origin.z * _scale_.y + _offset_.y);
+    glm::vec3 direction(_direction.x * _scale_.x, _direction.y, _direction.z * _scale_.y);
+    float t = _max_distance / length;
+    if (!raycastGrid(origin, direction, t))
+    {
+        return false;
+    }
+    distance = t * length;
+    return true;
+}
+
+bool HeightPyramid::IntersectSegment(const glm::vec3 &_from,
+                                     const glm::vec3 &_to,
+                                     glm::vec3 &hit) const
+{
+    glm::vec3 direction = _to - _from;
+    float distance;
+    if (!Raycast(_from, direction, glm::length(direction), distance))
+    {
+        return false;
+    }
+    hit = _from + glm::normalize(direction) * distance;
+    return true;
+}
+
+bool HeightPyramid::HasLineOfSight(const glm::vec3 &_from, const glm::vec3 &_to) const
+{
+    glm::vec3 hit;
+    return !IntersectSegment(_from, _to, hit);
+}
+
+void HeightPyramid::RaycastBatch(const Ray *_rays, const std::size_t _count, float *distances) const
+{
+    auto cast = [&](const uint32_t _begin, const uint32_t _end) {
+        for (uint32_t k = _begin; k < _end; k++)
+        {
+            if (!Raycast(_rays[k].origin, _rays[k].direction, _rays[k].max_distance, distances[k]))
+            {
+                distances[k] = std::numeric_limits<float>::infinity();
+            }
+        }
+    };
+
+    if (_count < _PARALLEL_BATCH_)
+    {
+        cast(0, (uint32_t)_count);
+        return;
+    }
+    Parallel::For(0, (uint32_t)_count, 256, cast);
+}
+
+void HeightPyramid::LineOfSightBatch(const glm::vec3 *_from,
+                                     const glm::vec3 *_to,
+                                     const std::size_t _count,
+                                     uint8_t *visible) const
+{
+    auto test = [&](const uint32_t _begin, const uint32_t _end) {
+        for (uint32_t k = _begin; k < _end; k++)
+        {
+            visible[k] = HasLineOfSight(_from[k], _to[k]) ? 1 : 0;
+        }
+    };
+
+    if (_count < _PARALLEL_BATCH_)
+    {
+        test(0, (uint32_t)_count);
+        return;
+    }
+    Parallel::For(0, (uint32_t)_count, 256, test);
+}
+
+void HeightPyramid::Refit(const uint32_t _i,
+                          const uint32_t _j,
+                          const uint32_t _rows,
+                          const uint32_t _cols)
+{
+    if (levels_.empty() || _rows == 0 || _cols == 0)
+    {
+        return;
+    }
+
+    // A grid point is a corner of the up to four quads around it.
+    //
+    uint32_t a_min = _i > 0 ? _i - 1 : 0;
+    uint32_t b_min = _j > 0 ? _j - 1 : 0;
+    uint32_t a_max = std::min(_i + _rows - 1, levels_[0].rows - 1);
+    uint32_t b_max = std::min(_j + _cols - 1, levels_[0].cols - 1);
+    for (uint32_t a = a_min; a <= a_max; a++)
+    {
+        for (uint32_t b = b_min; b <= b_max; b++)
+        {
+            levels_[0].ranges[(std::size_t)a * levels_[0].cols + b] = quadRange(a, b);
+        }
+    }
+
+    for (uint32_t l = 1; l < levels_.size(); l++)
+    {
+        a_min >>= 1;
+        b_min >>= 1;
+        a_max >>= 1;
+        b_max >>= 1;
+        for (uint32_t a = a_min; a <= a_max; a++)
+        {
+            for (uint32_t b = b_min; b <= b_max; b++)
+            {
+                levels_[l].ranges[(std::size_t)a * levels_[l].cols + b] = childRange(l, a, b);
+            }
+        }
+    }
+}
+
+uint32_t HeightPyramid::GetLevelCount() const { return (uint32_t)levels_.size(); }
+
+std::size_t HeightPyramid::GetByteSize() const
+{
+    std::size_t byte_size = 0;
+    for (const Level &level : levels_)
+    {
+        byte_size += sizeof(glm::vec2) * level.ranges.size();
+    }
+    return byte_size;
+}
+
+void HeightPyramid::buildLevels()
+{
+    if (heightfield_->GetRows() < 2 || heightfield_->GetCols() < 2)
+    {
+        std::cout << "ERROR::HEIGHT_PYRAMID::BUILD_LEVELS::HEIGHTFIELD_TOO_SMALL" << std::endl;
+        return;
+    }
+
+    Level level;
+    level.rows = heightfield_->GetRows() - 1;
+    level.cols = heightfield_->GetCols() - 1;
+    level.ranges.resize((std::size_t)level.rows * level.cols);
+    for (uint32_t a = 0; a < level.rows; a++)
+    {
+        for (uint32_t b = 0; b < level.cols; b++)
+        {
+            level.ranges[(std::size_t)a * level.cols + b] = quadRange(a, b);
+        }
+    }
+    levels_.push_back(level);
+
+    while (levels_.back().rows > 1 || levels_.back().cols > 1)
+    {
+        Level parent;
+        parent.rows = (levels_.back().rows + 1) / 2;
+        parent.cols = (levels_.back().cols + 1) / 2;
+        parent.ranges.resize((std::size_t)parent.rows * parent.cols);
+        levels_.push_back(parent);
+
+        const uint32_t l = (uint32_t)levels_.size() - 1;
+        for (uint32_t a = 0; a < parent.rows; a++)
+        {
+            for (uint32_t b = 0; b < parent.cols; b++)
+            {
+                levels_[l].ranges[(std::size_t)a * parent.cols + b] = childRange(l, a, b);
+            }
+        }
+    }
+}
+
+glm::vec2 HeightPyramid::quadRange(const uint32_t _i, const uint32_t _j) const
+{
+    float h00 = heightfield_->At(_i, _j);
+    float h01 = heightfield_->At(_i, _j + 1);
+    float h10 = heightfield_->At(_i + 1, _j);
+    float h11 = heightfield_->At(_i + 1, _j + 1);
+    return glm::vec2(std::min(std::min(h00, h01), std::min(h10, h11)),
+                     std::max(std::max(h00, h01), std::max(h10, h11)));
+}
+
+glm::vec2 HeightPyramid::childRange(const uint32_t _level,
+                                    const uint32_t _a,
+                                    const uint32_t _b) const
+{
+    const Level &child = levels_[_level - 1];
+    glm::vec2 range(std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest());
+    for (uint32_t a = 2 * _a; a < std::min(2 * _a + 2, child.rows); a++)
+    {
+        for (uint32_t b = 2 * _b; b < std::min(2 * _b + 2, child.cols); b++)
+        {
+            glm::vec2 child_range = child.ranges[(std::size_t)a * child.cols + b];
+            range.x = std::min(range.x, child_range.x);
+            range.y = std::max(range.y, child_range.y);
+        }
+    }
+    return range;
+}
+
+HeightPyramid::Box HeightPyramid::nodeBox(const uint32_t _level,
+                                          const uint32_t _a,
+                                          const uint32_t _b) const
+{
+    // A node spans 2^level quads per side, fewer at the far edges of the grid.
+    //
+    const Level &level = levels_[_level];
+    const glm::vec2 range = level.ranges[(std::size_t)_a * level.cols + _b];
+    const uint32_t i_max = std::min((_a + 1) << _level, levels_[0].rows);
+    const uint32_t j_max = std::min((_b + 1) << _level, levels_[0].cols);
+
+    Box box;
+    box.min = glm::vec3((float)(_a << _level), range.x, (float)(_b << _level));
+    box.max = glm::vec3((float)i_max, range.y, (float)j_max);
+    return box;
+}
+
+bool HeightPyramid::raycastGrid(const glm::vec3 &_origin,
+                                const glm::vec3 &_direction,
+                                float &t) const
+{
+    struct Entry
+    {
+        uint32_t level, a, b;
+        float t_enter;
+    };
+
+    // Every node pushes at most four children and the nearest one is popped next, so the stack
+    // never holds more than three nodes per level plus four.
+    //
+    Entry stack[4 * 32];
+    int size = 0;
+
+    const glm::vec3 inv_direction = 1.0f / _direction;
+    const uint32_t top = (uint32_t)levels_.size() - 1;
+    float best_t = t;
+    bool is_hit = false;
+
+    float t_enter;
+    if (!intersectBox(nodeBox(top, 0, 0), _origin, inv_direction, best_t, t_enter))
+    {
+        return false;
+    }
+    stack[size++] = {top, 0, 0, t_enter};
+
+    while (size > 0)
+    {
+        const Entry entry = stack[--size];
+        if (entry.t_enter > best_t)
+        {
+            continue;
+        }
+
+        if (entry.level == 0)
+        {
+            float quad_t = best_t;
+            if (intersectQuad(entry.a, entry.b, _origin, _direction, quad_t))
+            {
+                best_t = quad_t;
+                is_hit = true;
+            }
+            continue;
+        }
+
+        const Level &child = levels_[entry.level - 1];
+        Entry children[4];
+        int count = 0;
+        for (uint32_t a = 2 * entry.a; a < std::min(2 * entry.a + 2, child.rows); a++)
+        {
+            for (uint32_t b = 2 * entry.b; b < std::min(2 * entry.b + 2, child.cols); b++)
+            {
+                const Box box = nodeBox(entry.level - 1, a, b);
+                if (intersectBox(box, _origin, inv_direction, best_t, t_enter))
+                {
+                    children[count++] = {entry.level - 1, a, b, t_enter};
+                }
+            }
+        }
+
+        // Farthest first onto the stack, so the nearest child is visited next and its hit
+        // prunes the others. An insertion sort, there are at most four.
+        //
+        for (int c = 1; c < count; c++)
+        {
+            const Entry next = children[c];
+            int d = c;
+            for (; d > 0 && children[d - 1].t_enter < next.t_enter; d--)
+            {
+                children[d] = children[d - 1];
+            }
+            children[d] = next;
+        }
+        for (int c = 0; c < count; c++)
+        {
+            stack[size++] = children[c];
+        }
+    }
+
+    t = best_t;
+    return is_hit;
+}
+
+bool HeightPyramid::intersectQuad(const uint32_t _i,
+                                  const uint32_t _j,
+                                  const glm::vec3 &_origin,
+                                  const glm::vec3 &_direction,
+                                  float &t) const
+{
+    const float i = (float)_i;
+    const float j = (float)_j;
+    const glm::vec3 v0(i, heightfield_->At(_i, _j), j);
+    const glm::vec3 v1(i, heightfield_->At(_i, _j + 1), j + 1.0f);
+    const glm::vec3 v2(i + 1.0f, heightfield_->At(_i + 1, _j), j);
+    const glm::vec3 v3(i + 1.0f, heightfield_->At(_i + 1, _j + 1), j + 1.0f);
+
+    bool is_hit = intersectTriangle(v0, v1, v2, _origin, _direction, t);
+    is_hit = intersectTriangle(v2, v1, v3, _origin, _direction, t) || is_hit;
+    return is_hit;
+}
+
+bool HeightPyramid::intersectBox(const Box &_box,
+                                 const glm::vec3 &_origin,
+                                 const glm::vec3 &_inv_direction,
+                                 const float _t_max,
+                                 float &t_enter)
+{
+    float t_0 = 0.0f;
+    float t_1 = _t_max;
+    for (int axis = 0; axis < 3; axis++)
+    {
+        // A ray parallel to the slab either runs inside of it or misses the box.
+        //
+        if (std::isinf(_inv_direction[axis]))
+        {
+            if (_origin[axis] < _box.min[axis] || _origin[axis] > _box.max[axis])
+            {
+                return false;
+            }
+            continue;
+        }
+        float t_near = (_box.min[axis] - _origin[axis]) * _inv_direction[axis];
+        float t_far = (_box.max[axis] - _origin[axis]) * _inv_direction[axis];
+        if (t_near > t_far)
+        {
+            std::swap(t_near, t_far);
+        }
+        t_0 = std::max(t_0, t_near);
+        t_1 = std::min(t_1, t_far);
+        if (t_0 > t_1)
+        {
+            return false;
+        }
+    }
+    t_enter = t_0;
+    return true;
+}
+
+bool HeightPyramid::intersectTriangle(const glm::vec3 &_v0,
+                                      const glm::vec3 &_v1,
+                                      const glm::vec3 &_v2,
+                                      const glm::vec3 &_origin,
+                                      const glm::vec3 &_direction,
+                                      float &t)
+{
+    // Moller-Trumbore, from either side. The small tolerance on the barycentric coordinates
+    // keeps rays from slipping through the shared edges of neighbouring triangles.
+    //
+    const float epsilon = 1e-6f;
+    glm::vec3 edge_1 = _v1 - _v0;
+    glm::vec3 edge_2 = _v2 - _v0;
+    glm::vec3 p = glm::cross(_direction, edge_2);
+    float determinant = glm::dot(edge_1, p);
+    if (std::abs(determinant) <= std::numeric_limits<float>::min())
+    {
+        return false;
+    }
+    float inv_determinant = 1.0f / determinant;
+    glm::vec3 s = _origin - _v0;
+    float u = glm::dot(s, p) * inv_determinant;
+    if (u < -epsilon || u > 1.0f + epsilon)
+    {
+        return false;
+    }
+    glm::vec3 q = glm::cross(s, edge_1);
+    float v = glm::dot(_direction, q) * inv_determinant;
+    if (v < -epsilon || u + v > 1.0f + epsilon)
+    {
+        return false;
+    }
+    float hit_t = glm::dot(edge_2, q) * inv_determinant;
+    if (hit_t < 0.0f || hit_t > t)
+    {
+        return false;
+    }
+    t = hit_t;
+    return true;
+}
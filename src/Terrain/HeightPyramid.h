@@ -0,0 +1,112 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Application/Parallel.h"
+#include "Terrain/Heightfield.h"
+
+// Min/max mip pyramid over a heightfield for ray, segment and line of sight queries.
+//
+// Level 0 holds the height range of every quad, every further level the range of 2 x 2 nodes
+// of the level below, up to a single root node. A ray descends only into the nodes whose box
+// it crosses, nearest first, and tests the two triangles of the quads it reaches, which are
+// split like Heightfield::Sample. Over open terrain a query visits O(log n) nodes instead of
+// stepping through every quad under the ray.
+//
+// All queries are in world space. A world position maps to the grid point
+// (x * scale.x + offset.x, z * scale.y + offset.y), the heights are used as they are. The
+// pyramid has to be rebuilt, or the changed region refitted with Refit, when the heights
+// change.
+//
+class HeightPyramid
+{
+public:
+    struct Ray
+    {
+        glm::vec3 origin;
+        glm::vec3 direction;
+        float max_distance;
+    };
+
+    HeightPyramid(std::shared_ptr<const Heightfield> _heightfield,
+                  const glm::vec2 &_scale,
+                  const glm::vec2 &_offset);
+
+    // distance is the world space distance from _origin to the first hit closer than
+    // _max_distance. _direction does not need to be normalized.
+    //
+    bool Raycast(const glm::vec3 &_origin,
+                 const glm::vec3 &_direction,
+                 const float _max_distance,
+                 float &distance) const;
+    bool IntersectSegment(const glm::vec3 &_from, const glm::vec3 &_to, glm::vec3 &hit) const;
+    bool HasLineOfSight(const glm::vec3 &_from, const glm::vec3 &_to) const;
+
+    // Batched queries, large batches are spread over all cores. A ray that misses gets an
+    // infinite distance.
+    //
+    void RaycastBatch(const Ray *_rays, const std::size_t _count, float *distances) const;
+    void LineOfSightBatch(const glm::vec3 *_from,
+                          const glm::vec3 *_to,
+                          const std::size_t _count,
+                          uint8_t *visible) const;
+
+    // Recomputes the ranges of the quads touching the grid points [_i, _i + _rows) x
+    // [_j, _j + _cols) and of their ancestors.
+    //
+    void Refit(const uint32_t _i, const uint32_t _j, const uint32_t _rows, const uint32_t _cols);
+
+    uint32_t GetLevelCount() const;
+    std::size_t GetByteSize() const;
+
+private:
+    // Height range (min, max) of every node, row-major.
+    //
+    struct Level
+    {
+        uint32_t rows, cols;
+        std::vector<glm::vec2> ranges;
+    };
+
+    struct Box
+    {
+        glm::vec3 min, max;
+    };
+
+    std::shared_ptr<const Heightfield> heightfield_;
+    const glm::vec2 _scale_, _offset_;
+    std::vector<Level> levels_;
+
+    static const std::size_t _PARALLEL_BATCH_;
+
+    void buildLevels();
+    glm::vec2 quadRange(const uint32_t _i, const uint32_t _j) const;
+    glm::vec2 childRange(const uint32_t _level, const uint32_t _a, const uint32_t _b) const;
+    Box nodeBox(const uint32_t _level, const uint32_t _a, const uint32_t _b) const;
+    bool raycastGrid(const glm::vec3 &_origin, const glm::vec3 &_direction, float &t) const;
+    bool intersectQuad(const uint32_t _i,
+                       const uint32_t _j,
+                       const glm::vec3 &_origin,
+                       const glm::vec3 &_direction,
+                       float &t) const;
+
+    static bool intersectBox(const Box &_box,
+                             const glm::vec3 &_origin,
+                             const glm::vec3 &_inv_direction,
+                             const float _t_max,
+                             float &t_enter);
+    static bool intersectTriangle(const glm::vec3 &_v0,
+                                  const glm::vec3 &_v1,
+                                  const glm::vec3 &_v2,
+                                  const glm::vec3 &_origin,
+                                  const glm::vec3 &_direction,
+                                  float &t);
+};
@@ -0,0 +1,204 @@
+#include "Terrain/Heightfield.h"
+
+#if GOLD_RUSH_X86
+#include <immintrin.h>
+#endif
+
+// One cache line.
+//
+const std::size_t Heightfield::_ALIGNMENT_ = 64;
+
+#if GOLD_RUSH_X86
+// Corner heights of the quads at the grid indices _index, the gathers read 32 bits per lane.
+//
+GOLD_RUSH_TARGET_AVX2 inline __m256 gatherHeightsAvx2(const Heightfield &heightfield,
+                                                      const __m256i _index)
+{
+    if (heightfield.GetFormat() == HFFORMATenum::FLOAT32)
+    {
+        return _mm256_i32gather_ps(heightfield.GetFloatData(), _index, 4);
+    }
+    __m256i codes = _mm256_i32gather_epi32(
+        (const int *)heightfield.GetUInt16Data(), _index, 2);
+    codes = _mm256_and_si256(codes, _mm256_set1_epi32(0xFFFF));
+    return _mm256_add_ps(_mm256_set1_ps(heightfield.GetOffset()),
+                         _mm256_mul_ps(_mm256_set1_ps(heightfield.GetScale()),
+                                       _mm256_cvtepi32_ps(codes)));
+}
+
+GOLD_RUSH_TARGET_AVX2 std::size_t sampleBatchAvx2(const Heightfield &heightfield,
+                                                  const glm::vec3 *_positions,
+                                                  const std::size_t _count,
+                                                  const glm::vec2 &_scale,
+                                                  const glm::vec2 &_offset,
+                                                  float *heights)
+{
+    const int rows = (int)heightfield.GetRows();
+    const int cols = (int)heightfield.GetCols();
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 scale_x = _mm256_set1_ps(_scale.x);
+    const __m256 scale_z = _mm256_set1_ps(_scale.y);
+    const __m256 offset_x = _mm256_set1_ps(_offset.x);
+    const __m256 offset_z = _mm256_set1_ps(_offset.y);
+    const __m256 max_i = _mm256_set1_ps((float)(rows - 1));
+    const __m256 max_j = _mm256_set1_ps((float)(cols - 1));
+    const __m256i max_i0 = _mm256_set1_epi32(rows - 2);
+    const __m256i max_j0 = _mm256_set1_epi32(cols - 2);
+    const __m256i pitch = _mm256_set1_epi32(cols);
+    const __m256i stride = _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21);
+
+    std::size_t k = 0;
+    for (; k + 8 <= _count; k += 8)
+    {
+        // glm::vec3 is three packed floats, x and z are gathered with a stride of 3.
+        //
+        const float *position = &_positions[k].x;
+        __m256 x = _mm256_i32gather_ps(position, stride, 4);
+        __m256 z = _mm256_i32gather_ps(position + 2, stride, 4);
+
+        // max(x, 0) returns 0 for NaN lanes, like the scalar Sample.
+        //
+        __m256 i = _mm256_add_ps(_mm256_mul_ps(x, scale_x), offset_x);
+        __m256 j = _mm256_add_ps(_mm256_mul_ps(z, scale_z), offset_z);
+        i = _mm256_min_ps(_mm256_max_ps(i, zero), max_i);
+        j = _mm256_min_ps(_mm256_max_ps(j, zero), max_j);
+        __m256i i0 = _mm256_min_epi32(_mm256_cvttps_epi32(i), max_i0);
+        __m256i j0 = _mm256_min_epi32(_mm256_cvttps_epi32(j), max_j0);
+        __m256 u = _mm256_sub_ps(i, _mm256_cvtepi32_ps(i0));
+        __m256 v = _mm256_sub_ps(j, _mm256_cvtepi32_ps(j0));
+
+        __m256i index = _mm256_add_epi32(_mm256_mullo_epi32(i0, pitch), j0);
+        __m256 h00 = gatherHeightsAvx2(heightfield, index);
+        __m256 h01 = gatherHeightsAvx2(heightfield, _mm256_add_epi32(index, _mm256_set1_epi32(1)));
+        __m256 h10 = gatherHeightsAvx2(heightfield, _mm256_add_epi32(index, pitch));
+        __m256 h11 = gatherHeightsAvx2(
+            heightfield, _mm256_add_epi32(index, _mm256_add_epi32(pitch, _mm256_set1_epi32(1))));
+
+        // Heightfield::InterpolateTriangle with blends for the selects.
+        //
+        __m256 upper = _mm256_cmp_ps(_mm256_add_ps(u, v), one, _CMP_GT_OQ);
+        __m256 base = _mm256_blendv_ps(h00, h11, upper);
+        __m256 step_u = _mm256_blendv_ps(h10, h01, upper);
+        __m256 step_v = _mm256_blendv_ps(h01, h10, upper);
+        u = _mm256_blendv_ps(u, _mm256_sub_ps(one, u), upper);
+        v = _mm256_blendv_ps(v, _mm256_sub_ps(one, v), upper);
+        __m256 delta_u = _mm256_mul_ps(u, _mm256_sub_ps(step_u, base));
+        __m256 delta_v = _mm256_mul_ps(v, _mm256_sub_ps(step_v, base));
+        __m256 height = _mm256_add_ps(_mm256_add_ps(base, delta_u), delta_v);
+        _mm256_storeu_ps(heights + k, height);
+    }
+    return k;
+}
+#endif
+
+Heightfield::Heightfield(const uint32_t _rows, const uint32_t _cols, const HFFORMATenum _format)
+    : _rows_(_rows), _cols_(_cols), _format_(_format), scale_(1.0f), offset_(0.0f),
+      float_data_(nullptr), uint16_data_(nullptr)
+{
+    if (_format_ == HFFORMATenum::UINT16)
+    {
+        scale_ = 0.0f;
+    }
+
+    // One spare cache line, so the 32 bit gathers of the last UINT16 sample stay in bounds.
+    //
+    std::size_t byte_size = GetByteSize();
+    data_.reset(
+        (uint8_t *)::operator new[](byte_size + _ALIGNMENT_, std::align_val_t(_ALIGNMENT_)));
+    std::fill(data_.get(), data_.get() + byte_size + _ALIGNMENT_, (uint8_t)0);
+
+    if (_format_ == HFFORMATenum::FLOAT32)
+    {
+        float_data_ = (float *)data_.get();
+    }
+    else
+    {
+        uint16_data_ = (uint16_t *)data_.get();
+    }
+}
+
+void Heightfield::Assign(const float *_heights, const float _headroom)
+{
+    const std::size_t count = (std::size_t)_rows_ * _cols_;
+    if (_format_ == HFFORMATenum::FLOAT32)
+    {
+        std::copy(_heights, _heights + count, float_data_);
+        return;
+    }
+
+    float min_height = count > 0 ? *std::min_element(_heights, _heights + count) : 0.0f;
+    float max_height = count > 0 ? *std::max_element(_heights, _heights + count) : 0.0f;
+    const float headroom = _headroom * (max_height - min_height);
+    min_height -= headroom;
+    max_height += headroom;
+    offset_ = min_height;
+    scale_ = (max_height - min_height) / 65535.0f;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        uint16_data_[i] = encode(_heights[i]);
+    }
+}
+
+void Heightfield::SampleBatch(const glm::vec3 *_positions,
+                              const std::size_t _count,
+                              const glm::vec2 &_scale,
+                              const glm::vec2 &_offset,
+                              float *heights,
+                              const SIMDLEVELenum _simd_level) const
+{
+    // SSE2 has no gathers, it takes the scalar path.
+    //
+    std::size_t k = 0;
+#if GOLD_RUSH_X86
+    if (_simd_level == SIMDLEVELenum::AVX2)
+    {
+        k = sampleBatchAvx2(*this, _positions, _count, _scale, _offset, heights);
+    }
+#endif
+    for (; k < _count; k++)
+    {
+        heights[k] = Sample(_positions[k].x * _scale.x + _offset.x,
+                            _positions[k].z * _scale.y + _offset.y);
+    }
+}
+
+float Heightfield::GetMinHeight() const
+{
+    const std::size_t count = (std::size_t)_rows_ * _cols_;
+    if (count == 0)
+    {
+        return 0.0f;
+    }
+    if (_format_ == HFFORMATenum::FLOAT32)
+    {
+        return *std::min_element(float_data_, float_data_ + count);
+    }
+    return offset_ + scale_ * (float)*std::min_element(uint16_data_, uint16_data_ + count);
+}
+
+float Heightfield::GetMaxHeight() const
+{
+    const std::size_t count = (std::size_t)_rows_ * _cols_;
+    if (count == 0)
+    {
+        return 0.0f;
+    }
+    if (_format_ == HFFORMATenum::FLOAT32)
+    {
+        return *std::max_element(float_data_, float_data_ + count);
+    }
+    return offset_ + scale_ * (float)*std::max_element(uint16_data_, uint16_data_ + count);
+}
+
+std::size_t Heightfield::GetByteSize() const
+{
+    const std::size_t sample_size =
+        _format_ == HFFORMATenum::FLOAT32 ? sizeof(float) : sizeof(uint16_t);
+    return (std::size_t)_rows_ * _cols_ * sample_size;
+}
+
+void Heightfield::AlignedDelete::operator()(uint8_t *data) const
+{
+    ::operator delete[](data, std::align_val_t(Heightfield::_ALIGNMENT_));
+}
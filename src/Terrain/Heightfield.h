@@ -0,0 +1,185 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <new>
+
+#include <glm/glm.hpp>
+
+#include "Application/CpuFeatures.h"
+#include "Types/EHeightfield.h"
+#include "Types/ESimd.h"
+
+// Heights of a regular grid, without the x and z coordinates that follow from the indices.
+//
+// Sample (i, j) is at index i * cols + j. The samples are either plain floats or 16 bit codes
+// that decode as offset + scale * code, a 6x saving over a glm::vec3 grid at a resolution of
+// 1/65535 of the height range. The data starts on a 64 byte boundary, so a row of floats
+// begins on a cache line whenever cols is a multiple of 16.
+//
+// The accessors are not bounds checked. The samplers clamp to the grid and never throw.
+//
+class Heightfield
+{
+public:
+    Heightfield(const uint32_t _rows,
+                const uint32_t _cols,
+                const HFFORMATenum _format = HFFORMATenum::FLOAT32);
+    Heightfield(const Heightfield &) = delete;
+    Heightfield &operator=(const Heightfield &) = delete;
+
+    // Replaces all samples, rows * cols heights row by row. In the UINT16 format the scale and
+    // offset are refitted to the range of _heights, widened by _headroom times its extent
+    // below and above to leave room for later Set calls.
+    //
+    void Assign(const float *_heights, const float _headroom = 0.0f);
+
+    // A UINT16 height outside of the current range is clamped to it.
+    //
+    void Set(const uint32_t _i, const uint32_t _j, const float _height);
+    float At(const uint32_t _i, const uint32_t _j) const;
+
+    // Height of the terrain mesh at the fractional grid point (_i, _j), interpolated on the
+    // triangle of its quad like TerrainLod splits them. Needs at least 2 x 2 samples.
+    //
+    float Sample(const float _i, const float _j) const;
+
+    // Sample for _count positions at grid point (x * _scale.x + _offset.x, z * _scale.y +
+    // _offset.y). The AVX2 path samples 8 positions at a time with gathers.
+    //
+    void SampleBatch(const glm::vec3 *_positions,
+                     const std::size_t _count,
+                     const glm::vec2 &_scale,
+                     const glm::vec2 &_offset,
+                     float *heights,
+                     const SIMDLEVELenum _simd_level = CpuFeatures::GetSimdLevel()) const;
+
+    // Quad corners h_ij at (i, j), (u, v) in [0, 1]^2. The quad is split along the diagonal
+    // from (0, 1) to (1, 0).
+    //
+    static float InterpolateTriangle(const float _h00,
+                                     const float _h01,
+                                     const float _h10,
+                                     const float _h11,
+                                     const float _u,
+                                     const float _v);
+
+    uint32_t GetRows() const;
+    uint32_t GetCols() const;
+    HFFORMATenum GetFormat() const;
+    float GetScale() const;
+    float GetOffset() const;
+    float GetMinHeight() const;
+    float GetMaxHeight() const;
+    std::size_t GetByteSize() const;
+
+    // Raw samples, only the pointer matching the format is set.
+    //
+    const float *GetFloatData() const;
+    float *GetFloatData();
+    const uint16_t *GetUInt16Data() const;
+
+private:
+    struct AlignedDelete
+    {
+        void operator()(uint8_t *data) const;
+    };
+
+    const uint32_t _rows_, _cols_;
+    const HFFORMATenum _format_;
+    float scale_, offset_;
+
+    std::unique_ptr<uint8_t[], AlignedDelete> data_;
+    float *float_data_;
+    uint16_t *uint16_data_;
+
+    static const std::size_t _ALIGNMENT_;
+
+    uint16_t encode(const float _height) const;
+};
+
+inline void Heightfield::Set(const uint32_t _i, const uint32_t _j, const float _height)
+{
+    const std::size_t index = (std::size_t)_i * _cols_ + _j;
+    if (_format_ == HFFORMATenum::FLOAT32)
+    {
+        float_data_[index] = _height;
+        return;
+    }
+    uint16_data_[index] = encode(_height);
+}
+
+inline float Heightfield::At(const uint32_t _i, const uint32_t _j) const
+{
+    const std::size_t index = (std::size_t)_i * _cols_ + _j;
+    if (_format_ == HFFORMATenum::FLOAT32)
+    {
+        return float_data_[index];
+    }
+    return offset_ + scale_ * (float)uint16_data_[index];
+}
+
+inline float Heightfield::Sample(const float _i, const float _j) const
+{
+    // max(0, x) first, so a NaN coordinate ends up on the grid as well.
+    //
+    const float i = std::min(std::max(0.0f, _i), (float)(_rows_ - 1));
+    const float j = std::min(std::max(0.0f, _j), (float)(_cols_ - 1));
+    const uint32_t i0 = std::min((uint32_t)i, _rows_ - 2);
+    const uint32_t j0 = std::min((uint32_t)j, _cols_ - 2);
+    return InterpolateTriangle(At(i0, j0),
+                               At(i0, j0 + 1),
+                               At(i0 + 1, j0),
+                               At(i0 + 1, j0 + 1),
+                               i - (float)i0,
+                               j - (float)j0);
+}
+
+inline float Heightfield::InterpolateTriangle(const float _h00,
+                                              const float _h01,
+                                              const float _h10,
+                                              const float _h11,
+                                              const float _u,
+                                              const float _v)
+{
+    // Below the diagonal the triangle is (0, 0), (0, 1), (1, 0), above it (1, 1), (0, 1),
+    // (1, 0). Both are a corner plus the steps towards its two neighbours, written as
+    // selects so the compiler does not need a branch.
+    //
+    const bool upper = _u + _v > 1.0f;
+    const float base = upper ? _h11 : _h00;
+    const float step_u = upper ? _h01 : _h10;
+    const float step_v = upper ? _h10 : _h01;
+    const float u = upper ? 1.0f - _u : _u;
+    const float v = upper ? 1.0f - _v : _v;
+    return base + u * (step_u - base) + v * (step_v - base);
+}
+
+inline uint32_t Heightfield::GetRows() const { return _rows_; }
+
+inline uint32_t Heightfield::GetCols() const { return _cols_; }
+
+inline HFFORMATenum Heightfield::GetFormat() const { return _format_; }
+
+inline float Heightfield::GetScale() const { return scale_; }
+
+inline float Heightfield::GetOffset() const { return offset_; }
+
+inline const float *Heightfield::GetFloatData() const { return float_data_; }
+
+inline float *Heightfield::GetFloatData() { return float_data_; }
+
+inline const uint16_t *Heightfield::GetUInt16Data() const { return uint16_data_; }
+
+inline uint16_t Heightfield::encode(const float _height) const
+{
+    if (scale_ <= 0.0f)
+    {
+        return 0;
+    }
+    float code = std::round((_height - offset_) / scale_);
+    return (uint16_t)std::clamp(code, 0.0f, 65535.0f);
+}
@@ -1,92 +1,465 @@
-#include "Terrain/NoiseGenerator.h"
-
-std::shared_ptr<float[]> NoiseGenerator::PerlinNoise2D(const int _width,
-                                                       const int _height,
-                                                       const int _octaves,
-                                                       const float _bias)
-{
-    std::mt19937 rnd_eng(std::random_device{}());
-    std::uniform_real_distribution<float> dist(0, 1);
-
-    std::shared_ptr<float[]> seed(generateSeed(_width, _height, rnd_eng, dist));
-    std::shared_ptr<float[]> height_map(new float[_width * _height]);
-
-    for (int x = 0; x < _width; x++)
-    {
-        for (int y = 0; y < _height; y++)
-        {
-            float noise = 0.0f;
-            float scale_acc = 0.0f;
-            float scale = 1.0f;
-
-            for (int o = 0; o < _octaves; o++)
-            {
-                int pitch = _width >> o;
-                int sample_x1 = (x / pitch) * pitch;
-                int sample_y1 = (y / pitch) * pitch;
-
-                int sample_x2 = (sample_x1 + pitch) % _width;
-                int sample_y2 = (sample_y1 + pitch) % _width;
-
-                float blend_x = (float)(x - sample_x1) / (float)pitch;
-                float blend_y = (float)(y - sample_y1) / (float)pitch;
-
-                float sample_t = (1.0f - blend_x) * seed[sample_y1 * _width + sample_x1] +
-                                 blend_x * seed[sample_y1 * _width + sample_x2];
-                float sample_b = (1.0f - blend_x) * seed[sample_y2 * _width + sample_x1] +
-                                 blend_x * seed[sample_y2 * _width + sample_x2];
-
-                scale_acc += scale;
-                noise += (blend_y * (sample_b - sample_t) + sample_t) * scale;
-                scale = scale / _bias;
-            }
-
-            height_map[y * _width + x] = noise / scale_acc;
-        }
-    }
-
-    return height_map;
-}
-
-std::shared_ptr<float[]> NoiseGenerator::generateSeed(const int _width,
-                                                      const int _height,
-                                                      std::mt19937 &rnd_eng,
-                                                      std::uniform_real_distribution<float> &dist)
-{
-    std::shared_ptr<float[]> sp_seed(new float[_width * _height]);
-
-    for (int i = 0; i < _width * _height; i++)
-    {
-        sp_seed[i] = dist(rnd_eng);
-    }
-
-    return sp_seed;
-}
-
-double NoiseGenerator::fade(const double &_t)
-{
-    // THIS IS UNUSED.
-    // The equation proposed by Ken Perlin to replace the smoothstep function in 2002.
-    // The equation is the following: 6 * t ** 5 - 15 * t ** 4 + 10 * t ** 3
-    //
-    return 6 * pow(_t, 5) - 15 * pow(_t, 4) + 10 * pow(_t, 3);
-}
-
-double NoiseGenerator::lerp(const double &_lo, const double &_hi, const double &_t)
-{
-    // THIS IS UNUSED.
-    // Linear interpolate but there is a difference from the ordinary linear interpolation funciton.
-    // The normal equation is: t * p1 + (1 - t) * p2, but here we need a value that is between the
-    // low and high value, so we can get a smooth transition, hence the equation adds t * the
-    // diffenece to the min. So we get at minimum lo when t = 0 and at maximum hi when t = 1.
-    //
-    return _lo + _t * (_hi - _lo);
-}
-
-double NoiseGenerator::grad(const int _hash, const double _x, const double _y, const double _z)
-{
-    int h = _hash & 15;
-    double u = h < 8 ? _x : _y;
-    double v = h < 4 ? _y : h == 12 || h == 14 ? _x : _z;
-    return ((h & 1) == 0 ? u : -u) + ((h & 2) == 0 ? v : -v);
-}
+#include "Terrain/NoiseGenerator.h"
+
+#if GOLD_RUSH_X86
+#include <immintrin.h>
+#endif
+
+// Gradient noise is centered around zero. Scale and offset it so the height map keeps about the
+// same spread around 0.5 as the value noise it replaced.
+//
+const float NoiseGenerator::_AMPLITUDE_ = 0.45f;
+
+namespace
+{
+// Row constants of a single octave. The hashes of the two lattice rows enclosing the
+// current row are computed once per row and then looked up by cell index.
+//
+struct OctaveRow
+{
+    const uint32_t *hash_1;
+    const uint32_t *hash_2;
+    float frac_y;
+    float fade_y;
+};
+
+template <int OCTAVES> inline int octaveCount(const NoiseGenerator::Octaves &_octaves)
+{
+    return OCTAVES > 0 ? OCTAVES : _octaves.count;
+}
+
+// The reference implementation. The vector kernels below evaluate exactly the same
+// operations in the same order, and fall back to this one for the tail of each row.
+//
+template <int OCTAVES>
+inline float sampleScalar(const NoiseGenerator::Octaves &_octaves,
+                          const OctaveRow *_rows,
+                          const float _amplitude,
+                          const int _x)
+{
+    float noise = 0.0f;
+    for (int o = 0; o < octaveCount<OCTAVES>(_octaves); o++)
+    {
+        std::size_t i = (std::size_t)o * _octaves.width + _x;
+        int c = _octaves.cell_x[i];
+
+        float value = NoiseGenerator::Octave(_rows[o].hash_1[c],
+                                             _rows[o].hash_1[c + 1],
+                                             _rows[o].hash_2[c],
+                                             _rows[o].hash_2[c + 1],
+                                             _octaves.frac_x[i],
+                                             _rows[o].frac_y,
+                                             _octaves.fade_x[i],
+                                             _rows[o].fade_y);
+        noise += value * _octaves.scale[o];
+    }
+    return (noise / _octaves.scale_acc) * _amplitude + 0.5f;
+}
+
+template <int OCTAVES>
+void rowScalar(const NoiseGenerator::Octaves &_octaves,
+               const OctaveRow *_rows,
+               const float _amplitude,
+               float *row_out,
+               const int _x_begin)
+{
+    for (int x = _x_begin; x < _octaves.width; x++)
+    {
+        row_out[x] = sampleScalar<OCTAVES>(_octaves, _rows, _amplitude, x);
+    }
+}
+
+#if GOLD_RUSH_X86
+inline __m128 gradSse2(const __m128i _hash, const __m128 _x, const __m128 _y)
+{
+    __m128 swap = _mm_castsi128_ps(
+        _mm_cmpeq_epi32(_mm_and_si128(_hash, _mm_set1_epi32(4)), _mm_set1_epi32(4)));
+    __m128 u = _mm_or_ps(_mm_and_ps(swap, _y), _mm_andnot_ps(swap, _x));
+    __m128 v = _mm_or_ps(_mm_and_ps(swap, _x), _mm_andnot_ps(swap, _y));
+
+    // Negating is a flip of the sign bit, exactly like the scalar unary minus.
+    //
+    __m128i sign_u = _mm_slli_epi32(_mm_and_si128(_hash, _mm_set1_epi32(1)), 31);
+    __m128i sign_v = _mm_slli_epi32(_mm_and_si128(_hash, _mm_set1_epi32(2)), 30);
+    u = _mm_xor_ps(u, _mm_castsi128_ps(sign_u));
+    v = _mm_xor_ps(v, _mm_castsi128_ps(sign_v));
+    return _mm_add_ps(u, _mm_add_ps(v, v));
+}
+
+inline __m128 lerpSse2(const __m128 _lo, const __m128 _hi, const __m128 _t)
+{
+    return _mm_add_ps(_lo, _mm_mul_ps(_t, _mm_sub_ps(_hi, _lo)));
+}
+
+template <int OCTAVES>
+void rowSse2(const NoiseGenerator::Octaves &_octaves,
+             const OctaveRow *_rows,
+             const float _amplitude,
+             float *row_out)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+
+    int x = 0;
+    for (; x + 4 <= _octaves.width; x += 4)
+    {
+        __m128 noise = _mm_setzero_ps();
+        for (int o = 0; o < octaveCount<OCTAVES>(_octaves); o++)
+        {
+            std::size_t i = (std::size_t)o * _octaves.width + x;
+            const int *c = &_octaves.cell_x[i];
+            const uint32_t *r1 = _rows[o].hash_1;
+            const uint32_t *r2 = _rows[o].hash_2;
+
+            // SSE2 has no gather, so the lattice hashes are loaded one by one.
+            //
+            __m128i h00 = _mm_set_epi32(r1[c[3]], r1[c[2]], r1[c[1]], r1[c[0]]);
+            __m128i h10 = _mm_set_epi32(r1[c[3] + 1], r1[c[2] + 1], r1[c[1] + 1], r1[c[0] + 1]);
+            __m128i h01 = _mm_set_epi32(r2[c[3]], r2[c[2]], r2[c[1]], r2[c[0]]);
+            __m128i h11 = _mm_set_epi32(r2[c[3] + 1], r2[c[2] + 1], r2[c[1] + 1], r2[c[0] + 1]);
+
+            __m128 frac_x = _mm_loadu_ps(&_octaves.frac_x[i]);
+            __m128 fade_x = _mm_loadu_ps(&_octaves.fade_x[i]);
+            __m128 frac_y = _mm_set1_ps(_rows[o].frac_y);
+            __m128 fade_y = _mm_set1_ps(_rows[o].fade_y);
+            __m128 frac_x1 = _mm_sub_ps(frac_x, one);
+            __m128 frac_y1 = _mm_sub_ps(frac_y, one);
+
+            __m128 g00 = gradSse2(h00, frac_x, frac_y);
+            __m128 g10 = gradSse2(h10, frac_x1, frac_y);
+            __m128 g01 = gradSse2(h01, frac_x, frac_y1);
+            __m128 g11 = gradSse2(h11, frac_x1, frac_y1);
+            __m128 value =
+                lerpSse2(lerpSse2(g00, g10, fade_x), lerpSse2(g01, g11, fade_x), fade_y);
+
+            noise = _mm_add_ps(noise, _mm_mul_ps(value, _mm_set1_ps(_octaves.scale[o])));
+        }
+        noise = _mm_div_ps(noise, _mm_set1_ps(_octaves.scale_acc));
+        noise = _mm_add_ps(_mm_mul_ps(noise, _mm_set1_ps(_amplitude)), _mm_set1_ps(0.5f));
+        _mm_storeu_ps(&row_out[x], noise);
+    }
+
+    rowScalar<OCTAVES>(_octaves, _rows, _amplitude, row_out, x);
+}
+
+GOLD_RUSH_TARGET_AVX2 inline __m256 gradAvx2(const __m256i _hash, const __m256 _x, const __m256 _y)
+{
+    __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(
+        _mm256_and_si256(_hash, _mm256_set1_epi32(4)), _mm256_set1_epi32(4)));
+    __m256 u = _mm256_blendv_ps(_x, _y, swap);
+    __m256 v = _mm256_blendv_ps(_y, _x, swap);
+
+    __m256i sign_u = _mm256_slli_epi32(_mm256_and_si256(_hash, _mm256_set1_epi32(1)), 31);
+    __m256i sign_v = _mm256_slli_epi32(_mm256_and_si256(_hash, _mm256_set1_epi32(2)), 30);
+    u = _mm256_xor_ps(u, _mm256_castsi256_ps(sign_u));
+    v = _mm256_xor_ps(v, _mm256_castsi256_ps(sign_v));
+    return _mm256_add_ps(u, _mm256_add_ps(v, v));
+}
+
+GOLD_RUSH_TARGET_AVX2 inline __m256 lerpAvx2(const __m256 _lo, const __m256 _hi, const __m256 _t)
+{
+    // Multiplies and adds are kept separate on purpose. A fused multiply-add rounds
+    // once instead of twice and would break bit-equality with the scalar kernel.
+    //
+    return _mm256_add_ps(_lo, _mm256_mul_ps(_t, _mm256_sub_ps(_hi, _lo)));
+}
+
+template <int OCTAVES>
+GOLD_RUSH_TARGET_AVX2 void rowAvx2(const NoiseGenerator::Octaves &_octaves,
+                                   const OctaveRow *_rows,
+                                   const float _amplitude,
+                                   float *row_out)
+{
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256i next = _mm256_set1_epi32(1);
+
+    int x = 0;
+    for (; x + 8 <= _octaves.width; x += 8)
+    {
+        __m256 noise = _mm256_setzero_ps();
+        for (int o = 0; o < octaveCount<OCTAVES>(_octaves); o++)
+        {
+            std::size_t i = (std::size_t)o * _octaves.width + x;
+            __m256i c0 = _mm256_loadu_si256((const __m256i *)&_octaves.cell_x[i]);
+            __m256i c1 = _mm256_add_epi32(c0, next);
+            const int *r1 = (const int *)_rows[o].hash_1;
+            const int *r2 = (const int *)_rows[o].hash_2;
+
+            __m256i h00 = _mm256_i32gather_epi32(r1, c0, 4);
+            __m256i h10 = _mm256_i32gather_epi32(r1, c1, 4);
+            __m256i h01 = _mm256_i32gather_epi32(r2, c0, 4);
+            __m256i h11 = _mm256_i32gather_epi32(r2, c1, 4);
+
+            __m256 frac_x = _mm256_loadu_ps(&_octaves.frac_x[i]);
+            __m256 fade_x = _mm256_loadu_ps(&_octaves.fade_x[i]);
+            __m256 frac_y = _mm256_set1_ps(_rows[o].frac_y);
+            __m256 fade_y = _mm256_set1_ps(_rows[o].fade_y);
+            __m256 frac_x1 = _mm256_sub_ps(frac_x, one);
+            __m256 frac_y1 = _mm256_sub_ps(frac_y, one);
+
+            __m256 g00 = gradAvx2(h00, frac_x, frac_y);
+            __m256 g10 = gradAvx2(h10, frac_x1, frac_y);
+            __m256 g01 = gradAvx2(h01, frac_x, frac_y1);
+            __m256 g11 = gradAvx2(h11, frac_x1, frac_y1);
+            __m256 value =
+                lerpAvx2(lerpAvx2(g00, g10, fade_x), lerpAvx2(g01, g11, fade_x), fade_y);
+
+            noise =
+                _mm256_add_ps(noise, _mm256_mul_ps(value, _mm256_set1_ps(_octaves.scale[o])));
+        }
+        noise = _mm256_div_ps(noise, _mm256_set1_ps(_octaves.scale_acc));
+        noise =
+            _mm256_add_ps(_mm256_mul_ps(noise, _mm256_set1_ps(_amplitude)), _mm256_set1_ps(0.5f));
+        _mm256_storeu_ps(&row_out[x], noise);
+    }
+
+    rowScalar<OCTAVES>(_octaves, _rows, _amplitude, row_out, x);
+}
+#endif
+} // namespace
+
+std::shared_ptr<float[]> NoiseGenerator::PerlinNoise2D(const int _width,
+                                                       const int _height,
+                                                       const uint32_t _seed,
+                                                       const int _octaves,
+                                                       const float _bias,
+                                                       const SIMDLEVELenum _simd_level)
+{
+    Settings settings;
+    settings.seed = _seed;
+    settings.octaves = _octaves;
+    settings.bias = _bias;
+    settings.pitch = _width;
+    settings.wrap = 0;
+
+    std::shared_ptr<float[]> height_map(new float[_width * _height]);
+    PerlinNoise2DTile(settings, 0, 0, _width, _height, height_map.get(), _simd_level);
+
+    return height_map;
+}
+
+void NoiseGenerator::PerlinNoise2DTile(const Settings &_settings,
+                                       const int _x,
+                                       const int _y,
+                                       const int _width,
+                                       const int _height,
+                                       float *height_map,
+                                       const SIMDLEVELenum _simd_level)
+{
+    Octaves octaves = generateOctaves(_settings, _x, _y, _width, _height);
+
+    // The tile is split into bands of rows that are handed out to all cores. Each band
+    // is written in row-major order, so stores stay sequential.
+    //
+    Parallel::For(0, (uint32_t)_height, 16, [&](uint32_t row_begin, uint32_t row_end) {
+        switch (octaves.count)
+        {
+        case 1:
+            generateRows<1>(octaves, height_map, row_begin, row_end, _simd_level);
+            break;
+        case 2:
+            generateRows<2>(octaves, height_map, row_begin, row_end, _simd_level);
+            break;
+        case 3:
+            generateRows<3>(octaves, height_map, row_begin, row_end, _simd_level);
+            break;
+        case 4:
+            generateRows<4>(octaves, height_map, row_begin, row_end, _simd_level);
+            break;
+        case 5:
+            generateRows<5>(octaves, height_map, row_begin, row_end, _simd_level);
+            break;
+        case 6:
+            generateRows<6>(octaves, height_map, row_begin, row_end, _simd_level);
+            break;
+        case 7:
+            generateRows<7>(octaves, height_map, row_begin, row_end, _simd_level);
+            break;
+        case 8:
+            generateRows<8>(octaves, height_map, row_begin, row_end, _simd_level);
+            break;
+        default:
+            generateRows<0>(octaves, height_map, row_begin, row_end, _simd_level);
+            break;
+        }
+    });
+}
+
+float NoiseGenerator::PerlinNoise2DAt(const Settings &_settings, const double _x, const double _y)
+{
+    int count = CountOctaves(_settings);
+    float noise = 0.0f;
+    float scale = 1.0f;
+    float scale_acc = 0.0f;
+
+    for (int o = 0; o < count; o++)
+    {
+        int pitch = _settings.pitch >> o;
+        int cells = _settings.wrap > 0 ? std::max(1, _settings.wrap / pitch) : 0;
+        uint32_t seed = OctaveSeed(_settings.seed, o);
+
+        int cell_x, cell_y;
+        float frac_x, frac_y;
+        latticeCoord(_x, pitch, cell_x, frac_x);
+        latticeCoord(_y, pitch, cell_y, frac_y);
+
+        int x0 = wrapCell(cell_x, cells);
+        int x1 = wrapCell(cell_x + 1, cells);
+        int y0 = wrapCell(cell_y, cells);
+        int y1 = wrapCell(cell_y + 1, cells);
+
+        float value = Octave(Hash(seed, x0, y0),
+                             Hash(seed, x1, y0),
+                             Hash(seed, x0, y1),
+                             Hash(seed, x1, y1),
+                             frac_x,
+                             frac_y,
+                             Fade(frac_x),
+                             Fade(frac_y));
+        noise += value * scale;
+        scale_acc += scale;
+        scale = scale / _settings.bias;
+    }
+
+    return (noise / scale_acc) * _AMPLITUDE_ + 0.5f;
+}
+
+NoiseGenerator::Octaves NoiseGenerator::generateOctaves(const Settings &_settings,
+                                                        const int _x,
+                                                        const int _y,
+                                                        const int _width,
+                                                        const int _height)
+{
+    Octaves octaves;
+    octaves.count = CountOctaves(_settings);
+    octaves.x = _x;
+    octaves.y = _y;
+    octaves.width = _width;
+    octaves.height = _height;
+    octaves.wrap = _settings.wrap;
+    octaves.scale_acc = 0.0f;
+
+    std::size_t table_size = (std::size_t)octaves.count * _width;
+    octaves.cell_x.resize(table_size);
+    octaves.frac_x.resize(table_size);
+    octaves.fade_x.resize(table_size);
+
+    float scale = 1.0f;
+    for (int o = 0; o < octaves.count; o++)
+    {
+        int pitch = _settings.pitch >> o;
+        octaves.pitch.push_back(pitch);
+        octaves.seed.push_back(OctaveSeed(_settings.seed, o));
+        octaves.scale.push_back(scale);
+        octaves.scale_acc += scale;
+        scale = scale / _settings.bias;
+
+        int first_cell, last_cell;
+        float frac;
+        latticeCoord(_x, pitch, first_cell, frac);
+        latticeCoord(_x + _width - 1, pitch, last_cell, frac);
+        octaves.cell_x0.push_back(first_cell);
+        octaves.cell_count.push_back(last_cell - first_cell + 2);
+
+        for (int x = 0; x < _width; x++)
+        {
+            std::size_t i = (std::size_t)o * _width + x;
+            int cell;
+            latticeCoord(_x + x, pitch, cell, octaves.frac_x[i]);
+            octaves.cell_x[i] = cell - first_cell;
+            octaves.fade_x[i] = Fade(octaves.frac_x[i]);
+        }
+    }
+
+    return octaves;
+}
+
+int NoiseGenerator::CountOctaves(const Settings &_settings)
+{
+    // An octave with a pitch of zero has no lattice left to sample.
+    //
+    int count = 0;
+    while (count < _settings.octaves && (_settings.pitch >> count) > 0)
+    {
+        count++;
+    }
+    return count;
+}
+
+uint32_t NoiseGenerator::OctaveSeed(const uint32_t _seed, const int _octave)
+{
+    return Hash(_seed, _octave, 0x5eed);
+}
+
+float NoiseGenerator::GetAmplitude() { return _AMPLITUDE_; }
+
+int NoiseGenerator::wrapCell(const int _cell, const int _cells)
+{
+    if (_cells <= 0)
+    {
+        return _cell;
+    }
+    int cell = _cell % _cells;
+    return cell < 0 ? cell + _cells : cell;
+}
+
+void NoiseGenerator::latticeCoord(const double _position, const int _pitch, int &cell, float &frac)
+{
+    double lattice = _position / (double)_pitch;
+    double floor_lattice = std::floor(lattice);
+    cell = (int)floor_lattice;
+    frac = (float)(lattice - floor_lattice);
+}
+
+template <int OCTAVES>
+void NoiseGenerator::generateRows(const Octaves &_octaves,
+                                  float *height_map,
+                                  const int _row_begin,
+                                  const int _row_end,
+                                  const SIMDLEVELenum _simd_level)
+{
+    std::vector<OctaveRow> rows(_octaves.count);
+    std::vector<std::vector<uint32_t>> hashes(_octaves.count);
+
+    for (int y = _row_begin; y < _row_end; y++)
+    {
+        for (int o = 0; o < _octaves.count; o++)
+        {
+            int pitch = _octaves.pitch[o];
+            int cells = _octaves.wrap > 0 ? std::max(1, _octaves.wrap / pitch) : 0;
+            int count = _octaves.cell_count[o];
+
+            int cell_y;
+            latticeCoord(_octaves.y + y, pitch, cell_y, rows[o].frac_y);
+            rows[o].fade_y = Fade(rows[o].frac_y);
+
+            int y0 = wrapCell(cell_y, cells);
+            int y1 = wrapCell(cell_y + 1, cells);
+
+            std::vector<uint32_t> &hash = hashes[o];
+            hash.resize(2 * count);
+            for (int c = 0; c < count; c++)
+            {
+                int x = wrapCell(_octaves.cell_x0[o] + c, cells);
+                hash[c] = Hash(_octaves.seed[o], x, y0);
+                hash[count + c] = Hash(_octaves.seed[o], x, y1);
+            }
+            rows[o].hash_1 = hash.data();
+            rows[o].hash_2 = hash.data() + count;
+        }
+
+        float *row_out = height_map + (std::size_t)y * _octaves.width;
+        switch (_simd_level)
+        {
+#if GOLD_RUSH_X86
+        case SIMDLEVELenum::AVX2:
+            rowAvx2<OCTAVES>(_octaves, rows.data(), _AMPLITUDE_, row_out);
+            break;
+        case SIMDLEVELenum::SSE2:
+            rowSse2<OCTAVES>(_octaves, rows.data(), _AMPLITUDE_, row_out);
+            break;
+#endif
+        default:
+            rowScalar<OCTAVES>(_octaves, rows.data(), _AMPLITUDE_, row_out, 0);
+            break;
+        }
+    }
+}
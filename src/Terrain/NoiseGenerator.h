@@ -1,30 +1,170 @@
-#pragma once
-
-#include <cmath>
-#include <iomanip>
-#include <iostream>
-#include <map>
-#include <memory>
-#include <random>
-#include <string>
-
-class NoiseGenerator
-{
-public:
-    static std::shared_ptr<float[]> PerlinNoise2D(const int _width,
-                                                  const int _height,
-                                                  const int _octaves = 1,
-                                                  const float _bias = 0.2f);
-
-private:
-    NoiseGenerator();
-
-    static std::shared_ptr<float[]> generateSeed(const int _width,
-                                                 const int _height,
-                                                 std::mt19937 &rnd_eng,
-                                                 std::uniform_real_distribution<float> &dist);
-
-    static double fade(const double &_t);
-    static double lerp(const double &_lo, const double &_hi, const double &_t);
-    static double grad(const int _hash, const double _x, const double _y, const double _z);
-};
+#pragma once
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Application/CpuFeatures.h"
+#include "Application/Parallel.h"
+#include "Types/ESimd.h"
+
+// Gradient (Perlin) noise. The gradient at every lattice point is derived from a hash of the
+// seed and the integer lattice coordinates, so no random seed buffer is kept around and any
+// point or tile of the noise field can be evaluated on its own.
+//
+class NoiseGenerator
+{
+public:
+    struct Settings
+    {
+        uint32_t seed;
+        int octaves;
+        float bias;
+        // Lattice spacing of the first octave in samples. Every further octave halves it.
+        //
+        int pitch;
+        // Period in samples after which the noise repeats, or 0 for no wrapping.
+        //
+        int wrap;
+    };
+
+    // Lookup tables of a single tile. Everything that only depends on x (or on the octave)
+    // is computed once here, so the scalar and the vector kernels read the same precomputed
+    // values and produce bit-identical results.
+    //
+    struct Octaves
+    {
+        int count;
+        int x;
+        int y;
+        int width;
+        int height;
+        int wrap;
+        std::vector<int> pitch;
+        std::vector<uint32_t> seed;
+        std::vector<float> scale;
+        std::vector<int> cell_x0;
+        std::vector<int> cell_count;
+        std::vector<int> cell_x;
+        std::vector<float> frac_x;
+        std::vector<float> fade_x;
+        float scale_acc;
+    };
+
+    static std::shared_ptr<float[]>
+    PerlinNoise2D(const int _width,
+                  const int _height,
+                  const uint32_t _seed,
+                  const int _octaves = 1,
+                  const float _bias = 0.2f,
+                  const SIMDLEVELenum _simd_level = CpuFeatures::GetSimdLevel());
+    static void PerlinNoise2DTile(const Settings &_settings,
+                                  const int _x,
+                                  const int _y,
+                                  const int _width,
+                                  const int _height,
+                                  float *height_map,
+                                  const SIMDLEVELenum _simd_level = CpuFeatures::GetSimdLevel());
+    static float PerlinNoise2DAt(const Settings &_settings, const double _x, const double _y);
+
+    static int CountOctaves(const Settings &_settings);
+    static uint32_t OctaveSeed(const uint32_t _seed, const int _octave);
+    static float GetAmplitude();
+
+    static uint32_t Hash(const uint32_t _seed, const int _x, const int _y);
+    static float Fade(const float _t);
+    static float Lerp(const float _lo, const float _hi, const float _t);
+    static float Grad(const uint32_t _hash, const float _x, const float _y);
+    static float Octave(const uint32_t _h00,
+                        const uint32_t _h10,
+                        const uint32_t _h01,
+                        const uint32_t _h11,
+                        const float _frac_x,
+                        const float _frac_y,
+                        const float _fade_x,
+                        const float _fade_y);
+
+private:
+    NoiseGenerator();
+
+    static const float _AMPLITUDE_;
+
+    static Octaves generateOctaves(const Settings &_settings,
+                                   const int _x,
+                                   const int _y,
+                                   const int _width,
+                                   const int _height);
+    static int wrapCell(const int _cell, const int _cells);
+    static void latticeCoord(const double _position, const int _pitch, int &cell, float &frac);
+    template <int OCTAVES>
+    static void generateRows(const Octaves &_octaves,
+                             float *height_map,
+                             const int _row_begin,
+                             const int _row_end,
+                             const SIMDLEVELenum _simd_level);
+};
+
+inline uint32_t NoiseGenerator::Hash(const uint32_t _seed, const int _x, const int _y)
+{
+    // A few rounds of multiply-xorshift mixing, enough to decorrelate neighbouring
+    // lattice points without a permutation table.
+    //
+    uint32_t h = _seed ^ ((uint32_t)_x * 0x27d4eb2du) ^ ((uint32_t)_y * 0x165667b1u);
+    h ^= h >> 15;
+    h *= 0x2c1b3c6du;
+    h ^= h >> 12;
+    h *= 0x297a2d39u;
+    h ^= h >> 15;
+    return h;
+}
+
+inline float NoiseGenerator::Fade(const float _t)
+{
+    // The equation proposed by Ken Perlin to replace the smoothstep function in 2002.
+    // The equation is the following: 6 * t ** 5 - 15 * t ** 4 + 10 * t ** 3
+    //
+    return _t * _t * _t * (_t * (_t * 6.0f - 15.0f) + 10.0f);
+}
+
+inline float NoiseGenerator::Lerp(const float _lo, const float _hi, const float _t)
+{
+    // Linear interpolate but there is a difference from the ordinary linear interpolation funciton.
+    // The normal equation is: t * p1 + (1 - t) * p2, but here we need a value that is between the
+    // low and high value, so we can get a smooth transition, hence the equation adds t * the
+    // diffenece to the min. So we get at minimum lo when t = 0 and at maximum hi when t = 1.
+    //
+    return _lo + _t * (_hi - _lo);
+}
+
+inline float NoiseGenerator::Grad(const uint32_t _hash, const float _x, const float _y)
+{
+    // Dot product with one of the eight gradients (+-1, +-2) and (+-2, +-1).
+    //
+    uint32_t h = _hash & 7;
+    float u = (h & 4) == 0 ? _x : _y;
+    float v = (h & 4) == 0 ? _y : _x;
+    u = (h & 1) == 0 ? u : -u;
+    v = (h & 2) == 0 ? v : -v;
+    return u + (v + v);
+}
+
+inline float NoiseGenerator::Octave(const uint32_t _h00,
+                                    const uint32_t _h10,
+                                    const uint32_t _h01,
+                                    const uint32_t _h11,
+                                    const float _frac_x,
+                                    const float _frac_y,
+                                    const float _fade_x,
+                                    const float _fade_y)
+{
+    float g00 = Grad(_h00, _frac_x, _frac_y);
+    float g10 = Grad(_h10, _frac_x - 1.0f, _frac_y);
+    float g01 = Grad(_h01, _frac_x, _frac_y - 1.0f);
+    float g11 = Grad(_h11, _frac_x - 1.0f, _frac_y - 1.0f);
+    return Lerp(Lerp(g00, g10, _fade_x), Lerp(g01, g11, _fade_x), _fade_y);
+}
@@ -1,182 +1,538 @@
-#include "Terrain.h"
-
-Terrain::Terrain(const uint32_t _grid_size, const float _height_scale)
-    : _grid_size_(_grid_size), _height_scale_(_height_scale)
-{
-    TerrainGenerator tg(_grid_size_);
-    grid_ = tg.GetGrid();
-    setupVertices(tg.GetPositions(), tg.GetNormals(), tg.GetColors());
-    setupVegetation(tg.GetTrees(), tg.GetBushes(), tg.GetRocks(), tg.GetGrass());
-    setupCollectibles(tg.GetHazelnuts());
-    setupTerrain();
-    scaleGridHeight();
-}
-
-void Terrain::Draw(Shader &shader)
-{
-    shader.Use();
-    shader.SetMat4("model", glm::mat4(1.0f));
-
-    glBindVertexArray(vao_);
-    glDrawArrays(GL_TRIANGLES, 0, (GLsizei)vertices_.size());
-    glBindVertexArray(0);
-}
-
-std::shared_ptr<std::vector<glm::vec3>> Terrain::GetGrid() { return grid_; }
-
-float Terrain::GetHalfDimension() { return (float)_grid_size_; }
-
-std::shared_ptr<std::vector<glm::mat4>> Terrain::GetTree1ModelMats() { return tree_1_model_mats_; }
-
-std::shared_ptr<std::vector<glm::mat4>> Terrain::GetTree2ModelMats() { return tree_2_model_mats_; }
-
-std::shared_ptr<std::vector<glm::mat4>> Terrain::GetTree3ModelMats() { return tree_3_model_mats_; }
-
-std::shared_ptr<std::vector<glm::mat4>> Terrain::GetBushModelMats() { return bush_model_mats_; }
-
-std::shared_ptr<std::vector<glm::mat4>> Terrain::GetRockModelMats() { return rock_model_mats_; }
-
-std::shared_ptr<std::vector<glm::mat4>> Terrain::GetGrassModelMats() { return grass_model_mats_; }
-
-std::shared_ptr<std::vector<glm::mat4>> Terrain::GetHazelnutMats() { return hazelnut_model_mats_; }
-
-void Terrain::setupVertices(std::vector<glm::vec3> &positions,
-                            std::vector<glm::vec3> &normals,
-                            std::vector<glm::vec3> &colors)
-{
-    glm::mat4 mod_p_transform = getPositionTransform();
-    for (std::size_t i = 0; i < positions.size(); i++)
-    {
-        Terrain::Vertex vertex;
-        glm::vec4 position = glm::vec4(positions.at(i), 1.0f);
-        glm::vec4 normal = glm::vec4(normals.at(i), 1.0f);
-        vertex.position = glm::vec3(mod_p_transform * position);
-        vertex.normal = normals.at(i);
-        vertex.color = colors.at(i);
-        vertices_.push_back(vertex);
-    }
-}
-
-void Terrain::setupVegetation(std::vector<glm::vec3> &trees,
-                              std::vector<glm::vec3> &bushes,
-                              std::vector<glm::vec3> &rocks,
-                              std::vector<glm::vec3> &grass)
-{
-    std::vector<glm::mat4> tree_1_mod_mats, tree_2_mod_mats, tree_3_mod_mats, bush_mod_mats,
-        rock_mod_mats, grass_mod_mats;
-    glm::mat4 mod_transform = getPositionTransform();
-
-    for (std::size_t i = 0; i < trees.size(); i++)
-    {
-        trees.at(i) = glm::vec3(mod_transform * glm::vec4(trees.at(i), 1.0f));
-
-        // 1/5 of tree 1 (most costly to draw) and 2/5 of each tree 2 and 3.
-        //
-        if (i < trees.size() / 5)
-        {
-            tree_1_mod_mats.push_back(glm::translate(glm::mat4(1.0f), trees.at(i)));
-        }
-        else if (i < (trees.size() / 5) * 3)
-        {
-            tree_2_mod_mats.push_back(glm::translate(glm::mat4(1.0f), trees.at(i)));
-        }
-        else if (i < trees.size())
-        {
-            tree_3_mod_mats.push_back(glm::translate(glm::mat4(1.0f), trees.at(i)));
-        }
-    }
-    for (std::size_t i = 0; i < bushes.size(); i++)
-    {
-        bushes.at(i) = glm::vec3(mod_transform * glm::vec4(bushes.at(i), 1.0f));
-        bush_mod_mats.push_back(glm::translate(glm::mat4(1.0f), bushes.at(i)));
-    }
-    for (std::size_t i = 0; i < rocks.size(); i++)
-    {
-        rocks.at(i) = glm::vec3(mod_transform * glm::vec4(rocks.at(i), 1.0f));
-        rock_mod_mats.push_back(glm::translate(glm::mat4(1.0f), rocks.at(i)));
-    }
-    for (std::size_t i = 0; i < grass.size(); i++)
-    {
-        grass.at(i) = glm::vec3(mod_transform * glm::vec4(grass.at(i), 1.0f));
-        grass_mod_mats.push_back(glm::translate(glm::mat4(1.0f), grass.at(i)));
-    }
-
-    tree_1_model_mats_ = std::make_shared<std::vector<glm::mat4>>(tree_1_mod_mats);
-    tree_2_model_mats_ = std::make_shared<std::vector<glm::mat4>>(tree_2_mod_mats);
-    tree_3_model_mats_ = std::make_shared<std::vector<glm::mat4>>(tree_3_mod_mats);
-    bush_model_mats_ = std::make_shared<std::vector<glm::mat4>>(bush_mod_mats);
-    rock_model_mats_ = std::make_shared<std::vector<glm::mat4>>(rock_mod_mats);
-    grass_model_mats_ = std::make_shared<std::vector<glm::mat4>>(grass_mod_mats);
-}
-
-void Terrain::setupCollectibles(std::vector<glm::vec3> &hazelnuts)
-{
-    std::vector<glm::mat4> hz_mats;
-    glm::mat4 mod_transform = getPositionTransform();
-
-    for (std::size_t i = 0; i < hazelnuts.size(); i++)
-    {
-        hazelnuts.at(i) = glm::vec3(mod_transform * glm::vec4(hazelnuts.at(i), 1.0f));
-        hz_mats.push_back(glm::translate(glm::mat4(1.0f), hazelnuts.at(i)));
-    }
-
-    hazelnut_model_mats_ = std::make_shared<std::vector<glm::mat4>>(hz_mats);
-}
-
-void Terrain::setupTerrain()
-{
-    glGenVertexArrays(1, &vao_);
-    glGenBuffers(1, &vbo_);
-
-    glBindVertexArray(vao_);
-
-    glBindBuffer(GL_ARRAY_BUFFER, vbo_);
-    glBufferData(GL_ARRAY_BUFFER,
-                 sizeof(Terrain::Vertex) * vertices_.size(),
-                 vertices_.data(),
-                 GL_STATIC_DRAW);
-
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0,
-                          3,
-                          GL_FLOAT,
-                          GL_FALSE,
-                          sizeof(Terrain::Vertex),
-                          (const void *)(offsetof(Terrain::Vertex, Terrain::Vertex::position)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1,
-                          3,
-                          GL_FLOAT,
-                          GL_FALSE,
-                          sizeof(Terrain::Vertex),
-                          (const void *)(offsetof(Terrain::Vertex, Terrain::Vertex::normal)));
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2,
-                          3,
-                          GL_FLOAT,
-                          GL_FALSE,
-                          sizeof(Terrain::Vertex),
-                          (const void *)(offsetof(Terrain::Vertex, Terrain::Vertex::color)));
-
-    glBindVertexArray(0);
-}
-
-glm::mat4 Terrain::getPositionTransform()
-{
-    glm::mat4 mod_position = glm::mat4(1.0f);
-    mod_position =
-        glm::translate(mod_position, glm::vec3(-((float)_grid_size_), 0.0f, -((float)_grid_size_)));
-    mod_position =
-        glm::scale(mod_position,
-                   glm::vec3((float)(_grid_size_ * 2), _height_scale_, (float)(_grid_size_ * 2)));
-    return mod_position;
-}
-
-void Terrain::scaleGridHeight()
-{
-    glm::mat4 transform = getPositionTransform();
-    for (std::size_t i = 0; i < grid_->size(); i++)
-    {
-        grid_->at(i) = glm::vec3(transform * glm::vec4(grid_->at(i), 1.0f));
-    }
-}
+#include "Terrain.h"
+
+// Largest vertical distance of the adaptive mesh from the height grid, in world units.
+//
+const float Terrain::_RTIN_MAX_ERROR_ = 0.5f;
+
+// Fraction of the height range that Deform can dig below and raise above it, matches the
+// vertex buffer quantization of TerrainLod.
+//
+const float Terrain::_HEIGHT_HEADROOM_ = 0.5f;
+
+// Side of a vegetation cell in height samples.
+//
+const uint32_t Terrain::_VEGETATION_CELL_ = 8;
+
+Terrain::Terrain(const uint32_t _seed,
+                 const uint32_t _grid_size,
+                 const float _height_scale,
+                 const HMSOURCEenum _height_map_source,
+                 const TERRAINRENDERenum _render_mode,
+                 const HFFORMATenum _heightfield_format)
+    : _grid_size_(_grid_size), _height_scale_(_height_scale), occlusion_texture_(0),
+      vegetation_cell_count_(0)
+{
+    snapshot_ = std::make_shared<WorldSnapshot>(
+        WorldSnapshot::Key{_seed, _grid_size_, _height_scale_, TerrainGenerator::_VERSION_});
+    if (!snapshot_->Open() || !loadSnapshot(_render_mode, _heightfield_format))
+    {
+        generate(_seed, _height_map_source, _render_mode, _heightfield_format);
+    }
+    setupVegetationCells();
+    height_pyramid_ =
+        std::make_shared<HeightPyramid>(heightfield_, glm::vec2(0.5f), getSampleOffset());
+}
+
+void Terrain::Draw(Shader &shader, const Camera &camera)
+{
+    // Maps the world x and z of a vertex to the texel center of its grid point, see
+    // GetHeight.
+    //
+    const float scale = 0.5f / (float)_grid_size_;
+    const float offset = 0.5f + 0.5f / (float)_grid_size_;
+    shader.Use();
+    shader.SetVec4("occlusionTransform", glm::vec4(scale, scale, offset, offset));
+    shader.SetInt("ambientOcclusion", 1);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, occlusion_texture_);
+    glActiveTexture(GL_TEXTURE0);
+
+    if (rtin_)
+    {
+        rtin_->Draw(shader);
+        return;
+    }
+    lod_->Draw(shader, camera);
+}
+
+std::vector<Terrain::VegetationRef> Terrain::Deform(const glm::vec3 &_center,
+                                                    const float _radius,
+                                                    const float _amount)
+{
+    std::vector<Terrain::VegetationRef> moved;
+    if (rtin_)
+    {
+        std::cout << "ERROR::TERRAIN::DEFORM::ADAPTIVE_MESH_IS_STATIC" << std::endl;
+        return moved;
+    }
+
+    // The samples within the brush, in grid coordinates.
+    //
+    const glm::vec2 offset = getSampleOffset();
+    const float center_i = _center.x * 0.5f + offset.x;
+    const float center_j = _center.z * 0.5f + offset.y;
+    const float radius = _radius * 0.5f;
+    const float last = (float)(_grid_size_ - 1);
+    const float i_min = std::max(std::ceil(center_i - radius), 0.0f);
+    const float i_max = std::min(std::floor(center_i + radius), last);
+    const float j_min = std::max(std::ceil(center_j - radius), 0.0f);
+    const float j_max = std::min(std::floor(center_j + radius), last);
+    if (radius <= 0.0f || i_min > i_max || j_min > j_max)
+    {
+        return moved;
+    }
+    const uint32_t i_0 = (uint32_t)i_min;
+    const uint32_t j_0 = (uint32_t)j_min;
+    const uint32_t rows = (uint32_t)i_max - i_0 + 1;
+    const uint32_t cols = (uint32_t)j_max - j_0 + 1;
+
+    // The vegetation and the hazelnuts keep their offset to the ground, so remember the
+    // ground before the edit.
+    // The triangles next to the brush change as well, hence the extra sample.
+    //
+    std::vector<std::pair<VegetationRef, float>> vegetation;
+    const uint32_t cell_i_0 = getVegetationCell(i_min - 1.0f);
+    const uint32_t cell_i_1 = getVegetationCell(i_max + 1.0f);
+    const uint32_t cell_j_0 = getVegetationCell(j_min - 1.0f);
+    const uint32_t cell_j_1 = getVegetationCell(j_max + 1.0f);
+    for (uint32_t ci = cell_i_0; ci <= cell_i_1; ci++)
+    {
+        for (uint32_t cj = cell_j_0; cj <= cell_j_1; cj++)
+        {
+            for (const VegetationRef &ref : vegetation_cells_[ci * vegetation_cell_count_ + cj])
+            {
+                glm::vec3 position = glm::vec3(getVegetationMats(ref.kind)->at(ref.index)[3]);
+                if (std::abs(position.x * 0.5f + offset.x - center_i) <= radius + 1.0f &&
+                    std::abs(position.z * 0.5f + offset.y - center_j) <= radius + 1.0f)
+                {
+                    vegetation.push_back(std::make_pair(ref, GetHeight(position)));
+                }
+            }
+        }
+    }
+
+    // Raised cosine falloff, the full amount at the center and a flat joint at the rim.
+    //
+    const glm::mat4 transform = getPositionTransform();
+    std::vector<float> unit_heights((std::size_t)rows * cols);
+    for (uint32_t i = 0; i < rows; i++)
+    {
+        for (uint32_t j = 0; j < cols; j++)
+        {
+            const uint32_t si = i_0 + i;
+            const uint32_t sj = j_0 + j;
+            float distance = glm::length(glm::vec2((float)si - center_i, (float)sj - center_j));
+            if (distance < radius)
+            {
+                float weight = 0.5f + 0.5f * std::cos(glm::pi<float>() * distance / radius);
+                heightfield_->Set(si, sj, heightfield_->At(si, sj) + _amount * weight);
+            }
+
+            // Read back, so the mesh matches the quantized collision heights.
+            //
+            unit_heights[(std::size_t)i * cols + j] =
+                (heightfield_->At(si, sj) - transform[3][1]) / transform[1][1];
+        }
+    }
+    lod_->UpdateHeights(i_0, j_0, rows, cols, unit_heights.data());
+    height_pyramid_->Refit(i_0, j_0, rows, cols);
+    updateAmbientOcclusion(i_0, j_0, rows, cols);
+
+    for (const std::pair<VegetationRef, float> &entry : vegetation)
+    {
+        glm::mat4 &model = getVegetationMats(entry.first.kind)->at(entry.first.index);
+        model[3].y += GetHeight(glm::vec3(model[3])) - entry.second;
+        moved.push_back(entry.first);
+    }
+    return moved;
+}
+
+std::shared_ptr<Heightfield> Terrain::GetHeightfield() { return heightfield_; }
+
+std::shared_ptr<HeightPyramid> Terrain::GetHeightPyramid() { return height_pyramid_; }
+
+float Terrain::GetHalfDimension() { return (float)_grid_size_; }
+
+std::shared_ptr<std::vector<glm::mat4>> Terrain::GetTree1ModelMats() { return tree_1_model_mats_; }
+
+std::shared_ptr<std::vector<glm::mat4>> Terrain::GetTree2ModelMats() { return tree_2_model_mats_; }
+
+std::shared_ptr<std::vector<glm::mat4>> Terrain::GetTree3ModelMats() { return tree_3_model_mats_; }
+
+std::shared_ptr<std::vector<glm::mat4>> Terrain::GetBushModelMats() { return bush_model_mats_; }
+
+std::shared_ptr<std::vector<glm::mat4>> Terrain::GetRockModelMats() { return rock_model_mats_; }
+
+std::shared_ptr<std::vector<glm::mat4>> Terrain::GetGrassModelMats() { return grass_model_mats_; }
+
+std::shared_ptr<std::vector<glm::mat4>> Terrain::GetHazelnutMats() { return hazelnut_model_mats_; }
+
+const std::vector<uint32_t> &Terrain::GetHazelnutIndices() const { return hazelnut_indices_; }
+
+void Terrain::Collect(const uint32_t _hazelnut)
+{
+    std::size_t count;
+    uint8_t *collected =
+        snapshot_->GetMutableSection<uint8_t>(WSSECTIONenum::HAZELNUT_COLLECTED, count);
+    if (_hazelnut < count)
+    {
+        collected[_hazelnut] = 1;
+    }
+}
+
+void Terrain::RemoveHazelnut(const uint32_t _index)
+{
+    // Only the cells of the removed and of the last hazelnut change, the hazelnuts only ever
+    // move vertically, so they stay in the cell they were bucketed in.
+    //
+    std::vector<glm::mat4> &hazelnuts = *hazelnut_model_mats_;
+    const uint32_t last = (uint32_t)hazelnuts.size() - 1;
+    std::vector<VegetationRef> &cell = getVegetationRefs(hazelnuts[_index]);
+    for (std::size_t k = 0; k < cell.size(); k++)
+    {
+        if (cell[k].kind == 6 && cell[k].index == _index)
+        {
+            cell[k] = cell.back();
+            cell.pop_back();
+            break;
+        }
+    }
+    if (_index < last)
+    {
+        for (VegetationRef &ref : getVegetationRefs(hazelnuts[last]))
+        {
+            if (ref.kind == 6 && ref.index == last)
+            {
+                ref.index = _index;
+                break;
+            }
+        }
+    }
+    hazelnuts[_index] = hazelnuts[last];
+    hazelnuts.pop_back();
+}
+
+void Terrain::generate(const uint32_t _seed,
+                       const HMSOURCEenum _height_map_source,
+                       const TERRAINRENDERenum _render_mode,
+                       const HFFORMATenum _heightfield_format)
+{
+    TerrainGenerator tg(_grid_size_, _height_map_source, _seed, _height_scale_);
+    setupMesh(tg.GetPositions(), _render_mode, nullptr, 0);
+    setupAmbientOcclusion(tg.GetAmbientOcclusion().data());
+
+    // The mesh is on the GPU, so the generator's vertex positions can go before the heightfield
+    // and the pyramid are allocated.
+    //
+    std::vector<glm::vec3>().swap(tg.GetPositions());
+    setupVegetation(tg.GetTrees(), tg.GetBushes(), tg.GetRocks(), tg.GetGrass());
+    setupCollectibles(tg.GetHazelnuts());
+    setupHeightfield(*tg.GetHeightfield(), _heightfield_format);
+    writeSnapshot(*tg.GetHeightfield(), tg.GetAmbientOcclusion());
+}
+
+bool Terrain::loadSnapshot(const TERRAINRENDERenum _render_mode,
+                           const HFFORMATenum _heightfield_format)
+{
+    std::size_t height_count, occlusion_count, collected_count, hazelnut_count;
+    const float *heights = snapshot_->GetSection<float>(WSSECTIONenum::HEIGHTS, height_count);
+    const uint8_t *occlusion =
+        snapshot_->GetSection<uint8_t>(WSSECTIONenum::AMBIENT_OCCLUSION, occlusion_count);
+    const uint8_t *collected =
+        snapshot_->GetSection<uint8_t>(WSSECTIONenum::HAZELNUT_COLLECTED, collected_count);
+    const glm::mat4 *hazelnuts =
+        snapshot_->GetSection<glm::mat4>(WSSECTIONenum::HAZELNUT, hazelnut_count);
+    if (height_count != (std::size_t)_grid_size_ * _grid_size_ || occlusion_count != height_count ||
+        collected_count != hazelnut_count)
+    {
+        std::cout << "ERROR::TERRAIN::LOAD_SNAPSHOT::SECTION_SIZE_MISMATCH" << std::endl;
+        return false;
+    }
+
+    // The grid vertices follow from the heights. The vertex buffer needs them for the
+    // quantization range only, the level grids come from the snapshot.
+    //
+    Heightfield unit_heightfield(_grid_size_, _grid_size_);
+    std::copy(heights, heights + height_count, unit_heightfield.GetFloatData());
+    {
+        std::vector<glm::vec3> positions;
+        TerrainGenerator::GridPositions(unit_heightfield, positions);
+        std::size_t vertex_count;
+        const TerrainLod::Vertex *vertices = snapshot_->GetSection<TerrainLod::Vertex>(
+            WSSECTIONenum::TERRAIN_VERTICES, vertex_count);
+        setupMesh(positions, _render_mode, vertices, vertex_count);
+    }
+    setupAmbientOcclusion(occlusion);
+
+    std::shared_ptr<std::vector<glm::mat4>> *vegetation[6] = {&tree_1_model_mats_,
+                                                              &tree_2_model_mats_,
+                                                              &tree_3_model_mats_,
+                                                              &bush_model_mats_,
+                                                              &rock_model_mats_,
+                                                              &grass_model_mats_};
+    for (uint32_t kind = 0; kind < 6; kind++)
+    {
+        std::size_t count;
+        const WSSECTIONenum section = (WSSECTIONenum)((uint32_t)WSSECTIONenum::TREE_1 + kind);
+        const glm::mat4 *mats = snapshot_->GetSection<glm::mat4>(section, count);
+        *vegetation[kind] = std::make_shared<std::vector<glm::mat4>>(mats, mats + count);
+    }
+    hazelnut_model_mats_ = std::make_shared<std::vector<glm::mat4>>();
+    for (std::size_t i = 0; i < hazelnut_count; i++)
+    {
+        if (collected[i] == 0)
+        {
+            hazelnut_model_mats_->push_back(hazelnuts[i]);
+            hazelnut_indices_.push_back((uint32_t)i);
+        }
+    }
+
+    setupHeightfield(unit_heightfield, _heightfield_format);
+    return true;
+}
+
+void Terrain::writeSnapshot(const Heightfield &unit_heightfield,
+                            const std::vector<uint8_t> &occlusion)
+{
+    // Only the vertex buffer mode has level grids, the other modes rebuild their meshes from
+    // the heights.
+    //
+    std::vector<TerrainLod::Vertex> vertices;
+    if (lod_)
+    {
+        vertices = lod_->ReadVertices();
+    }
+    std::vector<uint8_t> collected(hazelnut_model_mats_->size(), 0);
+
+    std::vector<WorldSnapshot::Section> sections;
+    sections.push_back({unit_heightfield.GetFloatData(),
+                        sizeof(float) * unit_heightfield.GetRows() * unit_heightfield.GetCols()});
+    sections.push_back({vertices.data(), sizeof(TerrainLod::Vertex) * vertices.size()});
+    sections.push_back({occlusion.data(), occlusion.size()});
+    for (uint32_t kind = 0; kind < 6; kind++)
+    {
+        std::shared_ptr<std::vector<glm::mat4>> mats = getVegetationMats(kind);
+        sections.push_back({mats->data(), sizeof(glm::mat4) * mats->size()});
+    }
+    sections.push_back(
+        {hazelnut_model_mats_->data(), sizeof(glm::mat4) * hazelnut_model_mats_->size()});
+    sections.push_back({collected.data(), collected.size()});
+    snapshot_->Write(sections);
+}
+
+void Terrain::setupMesh(const std::vector<glm::vec3> &positions,
+                        const TERRAINRENDERenum _render_mode,
+                        const TerrainLod::Vertex *_level_vertices,
+                        const std::size_t _level_vertex_count)
+{
+    if (_render_mode == TERRAINRENDERenum::ADAPTIVE)
+    {
+        rtin_ = std::make_shared<TerrainRtin>(
+            positions, _grid_size_, getPositionTransform(), _RTIN_MAX_ERROR_);
+        rtin_->Upload();
+        return;
+    }
+    lod_ = std::make_shared<TerrainLod>(positions,
+                                        _grid_size_,
+                                        getPositionTransform(),
+                                        0.0f,
+                                        _render_mode,
+                                        true,
+                                        _level_vertices,
+                                        _level_vertex_count);
+}
+
+void Terrain::setupAmbientOcclusion(const uint8_t *_occlusion)
+{
+    glGenTextures(1, &occlusion_texture_);
+    glBindTexture(GL_TEXTURE_2D, occlusion_texture_);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(
+        GL_TEXTURE_2D, 0, GL_R8, _grid_size_, _grid_size_, 0, GL_RED, GL_UNSIGNED_BYTE, _occlusion);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void Terrain::updateAmbientOcclusion(const uint32_t _i,
+                                     const uint32_t _j,
+                                     const uint32_t _rows,
+                                     const uint32_t _cols)
+{
+    // The edited samples occlude everything within reach of them. The world heightfield is
+    // one world unit high per height unit, with a sample every 2 world units.
+    //
+    const uint32_t reach = AmbientOcclusion::GetReach();
+    const uint32_t i_0 = _i > reach ? _i - reach : 0;
+    const uint32_t j_0 = _j > reach ? _j - reach : 0;
+    const uint32_t rows = std::min(_i + _rows + reach, _grid_size_) - i_0;
+    const uint32_t cols = std::min(_j + _cols + reach, _grid_size_) - j_0;
+    std::vector<uint8_t> occlusion((std::size_t)rows * cols);
+    AmbientOcclusion::Bake(*heightfield_, 0.5f, i_0, j_0, rows, cols, occlusion.data());
+
+    glBindTexture(GL_TEXTURE_2D, occlusion_texture_);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D,
+                    0,
+                    j_0,
+                    i_0,
+                    cols,
+                    rows,
+                    GL_RED,
+                    GL_UNSIGNED_BYTE,
+                    occlusion.data());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void Terrain::setupVegetation(std::vector<glm::vec3> &trees,
+                              std::vector<glm::vec3> &bushes,
+                              std::vector<glm::vec3> &rocks,
+                              std::vector<glm::vec3> &grass)
+{
+    std::vector<glm::mat4> tree_1_mod_mats, tree_2_mod_mats, tree_3_mod_mats, bush_mod_mats,
+        rock_mod_mats, grass_mod_mats;
+    glm::mat4 mod_transform = getPositionTransform();
+
+    for (std::size_t i = 0; i < trees.size(); i++)
+    {
+        trees.at(i) = glm::vec3(mod_transform * glm::vec4(trees.at(i), 1.0f));
+
+        // 1/5 of tree 1 (most costly to draw) and 2/5 of each tree 2 and 3.
+        //
+        if (i < trees.size() / 5)
+        {
+            tree_1_mod_mats.push_back(glm::translate(glm::mat4(1.0f), trees.at(i)));
+        }
+        else if (i < (trees.size() / 5) * 3)
+        {
+            tree_2_mod_mats.push_back(glm::translate(glm::mat4(1.0f), trees.at(i)));
+        }
+        else if (i < trees.size())
+        {
+            tree_3_mod_mats.push_back(glm::translate(glm::mat4(1.0f), trees.at(i)));
+        }
+    }
+    for (std::size_t i = 0; i < bushes.size(); i++)
+    {
+        bushes.at(i) = glm::vec3(mod_transform * glm::vec4(bushes.at(i), 1.0f));
+        bush_mod_mats.push_back(glm::translate(glm::mat4(1.0f), bushes.at(i)));
+    }
+    for (std::size_t i = 0; i < rocks.size(); i++)
+    {
+        rocks.at(i) = glm::vec3(mod_transform * glm::vec4(rocks.at(i), 1.0f));
+        rock_mod_mats.push_back(glm::translate(glm::mat4(1.0f), rocks.at(i)));
+    }
+    for (std::size_t i = 0; i < grass.size(); i++)
+    {
+        grass.at(i) = glm::vec3(mod_transform * glm::vec4(grass.at(i), 1.0f));
+        grass_mod_mats.push_back(glm::translate(glm::mat4(1.0f), grass.at(i)));
+    }
+
+    tree_1_model_mats_ = std::make_shared<std::vector<glm::mat4>>(tree_1_mod_mats);
+    tree_2_model_mats_ = std::make_shared<std::vector<glm::mat4>>(tree_2_mod_mats);
+    tree_3_model_mats_ = std::make_shared<std::vector<glm::mat4>>(tree_3_mod_mats);
+    bush_model_mats_ = std::make_shared<std::vector<glm::mat4>>(bush_mod_mats);
+    rock_model_mats_ = std::make_shared<std::vector<glm::mat4>>(rock_mod_mats);
+    grass_model_mats_ = std::make_shared<std::vector<glm::mat4>>(grass_mod_mats);
+}
+
+void Terrain::setupVegetationCells()
+{
+    vegetation_cell_count_ = (_grid_size_ + _VEGETATION_CELL_ - 1) / _VEGETATION_CELL_;
+    vegetation_cells_.assign((std::size_t)vegetation_cell_count_ * vegetation_cell_count_,
+                             std::vector<VegetationRef>());
+    for (uint32_t kind = 0; kind < 7; kind++)
+    {
+        std::shared_ptr<std::vector<glm::mat4>> mats = getVegetationMats(kind);
+        for (uint32_t index = 0; index < mats->size(); index++)
+        {
+            getVegetationRefs(mats->at(index)).push_back({kind, index});
+        }
+    }
+}
+
+void Terrain::setupCollectibles(std::vector<glm::vec3> &hazelnuts)
+{
+    std::vector<glm::mat4> hz_mats;
+    glm::mat4 mod_transform = getPositionTransform();
+
+    for (std::size_t i = 0; i < hazelnuts.size(); i++)
+    {
+        hazelnuts.at(i) = glm::vec3(mod_transform * glm::vec4(hazelnuts.at(i), 1.0f));
+        hz_mats.push_back(glm::translate(glm::mat4(1.0f), hazelnuts.at(i)));
+        hazelnut_indices_.push_back((uint32_t)i);
+    }
+
+    hazelnut_model_mats_ = std::make_shared<std::vector<glm::mat4>>(hz_mats);
+}
+
+glm::mat4 Terrain::getPositionTransform()
+{
+    glm::mat4 mod_position = glm::mat4(1.0f);
+    mod_position =
+        glm::translate(mod_position, glm::vec3(-((float)_grid_size_), 0.0f, -((float)_grid_size_)));
+    mod_position =
+        glm::scale(mod_position,
+                   glm::vec3((float)(_grid_size_ * 2), _height_scale_, (float)(_grid_size_ * 2)));
+    return mod_position;
+}
+
+void Terrain::setupHeightfield(const Heightfield &unit_heightfield, const HFFORMATenum _format)
+{
+    // The world height only depends on the unit height, y' = m[1][1] * y + m[3][1].
+    //
+    glm::mat4 transform = getPositionTransform();
+    const uint32_t rows = unit_heightfield.GetRows();
+    const uint32_t cols = unit_heightfield.GetCols();
+    std::vector<float> heights((std::size_t)rows * cols);
+    for (uint32_t i = 0; i < rows; i++)
+    {
+        for (uint32_t j = 0; j < cols; j++)
+        {
+            heights[(std::size_t)i * cols + j] =
+                transform[1][1] * unit_heightfield.At(i, j) + transform[3][1];
+        }
+    }
+
+    heightfield_ = std::make_shared<Heightfield>(rows, cols, _format);
+    heightfield_->Assign(heights.data(), _HEIGHT_HEADROOM_);
+}
+
+std::shared_ptr<std::vector<glm::mat4>> Terrain::getVegetationMats(const uint32_t _kind)
+{
+    switch (_kind)
+    {
+    case 0:
+        return tree_1_model_mats_;
+    case 1:
+        return tree_2_model_mats_;
+    case 2:
+        return tree_3_model_mats_;
+    case 3:
+        return bush_model_mats_;
+    case 4:
+        return rock_model_mats_;
+    case 5:
+        return grass_model_mats_;
+    default:
+        return hazelnut_model_mats_;
+    }
+}
+
+uint32_t Terrain::getVegetationCell(const float _i)
+{
+    const float cell = std::floor(_i / (float)_VEGETATION_CELL_);
+    return (uint32_t)glm::clamp(cell, 0.0f, (float)(vegetation_cell_count_ - 1));
+}
+
+std::vector<Terrain::VegetationRef> &Terrain::getVegetationRefs(const glm::mat4 &_model)
+{
+    const glm::vec2 offset = getSampleOffset();
+    const uint32_t ci = getVegetationCell(_model[3].x * 0.5f + offset.x);
+    const uint32_t cj = getVegetationCell(_model[3].z * 0.5f + offset.y);
+    return vegetation_cells_[ci * vegetation_cell_count_ + cj];
+}
@@ -1,68 +1,176 @@
-#pragma once
-
-#include <iostream>
-#include <vector>
-
-#include <glad/glad.h>
-#include <GLFW/glfw3.h>
-#include <glm/glm.hpp>
-#include <glm/gtc/matrix_transform.hpp>
-#include <glm/gtc/type_ptr.hpp>
-
-#include <Renderer/Shader.h>
-#include <Terrain/TerrainGenerator.h>
-
-class Terrain
-{
-public:
-    struct Vertex
-    {
-        glm::vec3 position;
-        glm::vec3 normal;
-        glm::vec3 color;
-    };
-
-    std::vector<Terrain::Vertex> vertices_;
-
-    Terrain(const uint32_t _grid_size = 256, const float _height_scale = 10.0f);
-
-    void Draw(Shader &shader);
-
-    std::shared_ptr<std::vector<glm::vec3>> GetGrid();
-    float GetHalfDimension();
-
-    std::shared_ptr<std::vector<glm::mat4>> GetTree1ModelMats();
-    std::shared_ptr<std::vector<glm::mat4>> GetTree2ModelMats();
-    std::shared_ptr<std::vector<glm::mat4>> GetTree3ModelMats();
-    std::shared_ptr<std::vector<glm::mat4>> GetBushModelMats();
-    std::shared_ptr<std::vector<glm::mat4>> GetRockModelMats();
-    std::shared_ptr<std::vector<glm::mat4>> GetGrassModelMats();
-    std::shared_ptr<std::vector<glm::mat4>> GetHazelnutMats();
-
-private:
-    const uint32_t _grid_size_;
-    const float _height_scale_;
-    std::shared_ptr<std::vector<glm::vec3>> grid_;
-
-    uint32_t vao_, vbo_;
-
-    std::shared_ptr<std::vector<glm::mat4>> tree_1_model_mats_;
-    std::shared_ptr<std::vector<glm::mat4>> tree_2_model_mats_;
-    std::shared_ptr<std::vector<glm::mat4>> tree_3_model_mats_;
-    std::shared_ptr<std::vector<glm::mat4>> bush_model_mats_;
-    std::shared_ptr<std::vector<glm::mat4>> rock_model_mats_;
-    std::shared_ptr<std::vector<glm::mat4>> grass_model_mats_;
-    std::shared_ptr<std::vector<glm::mat4>> hazelnut_model_mats_;
-
-    void setupVertices(std::vector<glm::vec3> &positions,
-                       std::vector<glm::vec3> &normals,
-                       std::vector<glm::vec3> &colors);
-    void setupVegetation(std::vector<glm::vec3> &trees,
-                         std::vector<glm::vec3> &bushes,
-                         std::vector<glm::vec3> &rocks,
-                         std::vector<glm::vec3> &grass);
-    void setupCollectibles(std::vector<glm::vec3> &hazelnuts);
-    void setupTerrain();
-    glm::mat4 getPositionTransform();
-    void scaleGridHeight();
-};
+#pragma once
+
+#include <iostream>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include <Renderer/Camera.h>
+#include <Renderer/Shader.h>
+#include <Terrain/AmbientOcclusion.h>
+#include <Terrain/HeightPyramid.h>
+#include <Terrain/Heightfield.h>
+#include <Terrain/TerrainGenerator.h>
+#include <Terrain/TerrainLod.h>
+#include <Terrain/TerrainRtin.h>
+#include <Terrain/WorldSnapshot.h>
+
+// The world of a seed is generated once. The unit heights, the vertex buffer, the baked ambient
+// occlusion, the vegetation and the hazelnuts then go to a WorldSnapshot, and every later start
+// with the same seed, grid size and height scale maps the snapshot instead of running
+// TerrainGenerator. Deform only changes the running world, the snapshot keeps the generated
+// terrain.
+//
+class Terrain
+{
+public:
+    // Instance _index of vegetation kind _kind, in the order of getVegetationMats, the
+    // hazelnuts last.
+    //
+    struct VegetationRef
+    {
+        uint32_t kind;
+        uint32_t index;
+    };
+
+    Terrain(const uint32_t _seed,
+            const uint32_t _grid_size = 256,
+            const float _height_scale = 10.0f,
+            const HMSOURCEenum _height_map_source = HMSOURCEenum::CPU,
+            const TERRAINRENDERenum _render_mode = TERRAINRENDERenum::VERTEX_BUFFER,
+            const HFFORMATenum _heightfield_format = HFFORMATenum::UINT16);
+
+    void Draw(Shader &shader, const Camera &camera);
+
+    // Raises the terrain within _radius of _center by up to _amount world units, negative amounts
+    // dig. The brush falls off smoothly to its rim. The mesh, heightfield, ambient occlusion and
+    // height pyramid are updated and the vegetation and the hazelnuts in reach follow the
+    // ground, all in time proportional to the brush area. Not supported with
+    // TERRAINRENDERenum::ADAPTIVE, whose triangulation depends on the whole map. Returns the
+    // instances that moved, so their copies elsewhere can follow.
+    //
+    std::vector<Terrain::VegetationRef> Deform(const glm::vec3 &_center,
+                                               const float _radius,
+                                               const float _amount);
+
+    // World space heights, sample (i, j) lies at x = 2i - grid size, z = 2j - grid size.
+    //
+    std::shared_ptr<Heightfield> GetHeightfield();
+    std::shared_ptr<HeightPyramid> GetHeightPyramid();
+    float GetHalfDimension();
+
+    // Height of the finest terrain mesh below a world position, clamped to the map. The batch
+    // variant writes _count heights and uses the AVX2 gathers when the CPU has them.
+    //
+    float GetHeight(const glm::vec3 &_position) const;
+    void GetHeights(const glm::vec3 *_positions, const std::size_t _count, float *heights) const;
+
+    std::shared_ptr<std::vector<glm::mat4>> GetTree1ModelMats();
+    std::shared_ptr<std::vector<glm::mat4>> GetTree2ModelMats();
+    std::shared_ptr<std::vector<glm::mat4>> GetTree3ModelMats();
+    std::shared_ptr<std::vector<glm::mat4>> GetBushModelMats();
+    std::shared_ptr<std::vector<glm::mat4>> GetRockModelMats();
+    std::shared_ptr<std::vector<glm::mat4>> GetGrassModelMats();
+    std::shared_ptr<std::vector<glm::mat4>> GetHazelnutMats();
+
+    // The index in the snapshot of every hazelnut of GetHazelnutMats, in the order it had
+    // when the terrain was created.
+    //
+    const std::vector<uint32_t> &GetHazelnutIndices() const;
+
+    // Marks the hazelnut with the snapshot index _hazelnut as collected, so it is left out on
+    // the next start.
+    //
+    void Collect(const uint32_t _hazelnut);
+
+    // Removes instance _index of GetHazelnutMats, the last hazelnut takes its place.
+    //
+    void RemoveHazelnut(const uint32_t _index);
+
+private:
+    const uint32_t _grid_size_;
+    const float _height_scale_;
+    std::shared_ptr<Heightfield> heightfield_;
+    std::shared_ptr<HeightPyramid> height_pyramid_;
+    // Exactly one of the two is set, rtin_ with TERRAINRENDERenum::ADAPTIVE.
+    //
+    std::shared_ptr<TerrainLod> lod_;
+    std::shared_ptr<TerrainRtin> rtin_;
+
+    // R8 texture of the ambient occlusion of every grid point, texel (j, i) for sample (i, j)
+    // like the height texture of TerrainLod.
+    //
+    uint32_t occlusion_texture_;
+
+    std::shared_ptr<std::vector<glm::mat4>> tree_1_model_mats_;
+    std::shared_ptr<std::vector<glm::mat4>> tree_2_model_mats_;
+    std::shared_ptr<std::vector<glm::mat4>> tree_3_model_mats_;
+    std::shared_ptr<std::vector<glm::mat4>> bush_model_mats_;
+    std::shared_ptr<std::vector<glm::mat4>> rock_model_mats_;
+    std::shared_ptr<std::vector<glm::mat4>> grass_model_mats_;
+    std::shared_ptr<std::vector<glm::mat4>> hazelnut_model_mats_;
+    std::vector<uint32_t> hazelnut_indices_;
+
+    // The vegetation and the hazelnuts bucketed by square cells of _VEGETATION_CELL_ samples,
+    // so Deform finds the instances in reach without going through all of them.
+    //
+    std::vector<std::vector<VegetationRef>> vegetation_cells_;
+    uint32_t vegetation_cell_count_;
+
+    // Stays mapped, Collect writes through it.
+    //
+    std::shared_ptr<WorldSnapshot> snapshot_;
+
+    static const float _RTIN_MAX_ERROR_;
+    static const float _HEIGHT_HEADROOM_;
+    static const uint32_t _VEGETATION_CELL_;
+
+    void generate(const uint32_t _seed,
+                  const HMSOURCEenum _height_map_source,
+                  const TERRAINRENDERenum _render_mode,
+                  const HFFORMATenum _heightfield_format);
+    bool loadSnapshot(const TERRAINRENDERenum _render_mode, const HFFORMATenum _heightfield_format);
+    void writeSnapshot(const Heightfield &unit_heightfield, const std::vector<uint8_t> &occlusion);
+    void setupMesh(const std::vector<glm::vec3> &positions,
+                   const TERRAINRENDERenum _render_mode,
+                   const TerrainLod::Vertex *_level_vertices,
+                   const std::size_t _level_vertex_count);
+    void setupAmbientOcclusion(const uint8_t *_occlusion);
+    void updateAmbientOcclusion(const uint32_t _i,
+                                const uint32_t _j,
+                                const uint32_t _rows,
+                                const uint32_t _cols);
+    void setupVegetation(std::vector<glm::vec3> &trees,
+                         std::vector<glm::vec3> &bushes,
+                         std::vector<glm::vec3> &rocks,
+                         std::vector<glm::vec3> &grass);
+    void setupVegetationCells();
+    void setupCollectibles(std::vector<glm::vec3> &hazelnuts);
+    glm::mat4 getPositionTransform();
+    void setupHeightfield(const Heightfield &unit_heightfield, const HFFORMATenum _format);
+    glm::vec2 getSampleOffset() const;
+    std::shared_ptr<std::vector<glm::mat4>> getVegetationMats(const uint32_t _kind);
+    uint32_t getVegetationCell(const float _i);
+    std::vector<VegetationRef> &getVegetationRefs(const glm::mat4 &_model);
+};
+
+inline float Terrain::GetHeight(const glm::vec3 &_position) const
+{
+    // One sample every 2 world units, sample (0, 0) at (-grid size, -grid size).
+    //
+    const glm::vec2 offset = getSampleOffset();
+    return heightfield_->Sample(_position.x * 0.5f + offset.x, _position.z * 0.5f + offset.y);
+}
+
+inline void Terrain::GetHeights(const glm::vec3 *_positions,
+                                const std::size_t _count,
+                                float *heights) const
+{
+    heightfield_->SampleBatch(_positions, _count, glm::vec2(0.5f), getSampleOffset(), heights);
+}
+
+inline glm::vec2 Terrain::getSampleOffset() const { return glm::vec2((float)_grid_size_ * 0.5f); }
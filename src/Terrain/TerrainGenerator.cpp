@@ -1,153 +1,157 @@
-#include "Terrain/TerrainGenerator.h"
-
-TerrainGenerator::TerrainGenerator(const uint32_t _grid_size) : _grid_size_(_grid_size)
-{
-    generateHeightMap();
-    generateGrid();
-    generateVertexPositions();
-    generateVertexColors();
-    generateVegetationPositions();
-}
-
-std::shared_ptr<std::vector<glm::vec3>> TerrainGenerator::GetGrid() { return grid_; }
-
-std::vector<glm::vec3> &TerrainGenerator::GetPositions() { return positions_; }
-
-std::vector<glm::vec3> &TerrainGenerator::GetNormals() { return normals_; }
-
-std::vector<glm::vec3> &TerrainGenerator::GetColors() { return colors_; }
-
-std::vector<glm::vec3> &TerrainGenerator::GetTrees() { return tree_positions_; }
-
-std::vector<glm::vec3> &TerrainGenerator::GetBushes() { return bush_positions_; }
-
-std::vector<glm::vec3> &TerrainGenerator::GetRocks() { return rock_positions_; }
-
-std::vector<glm::vec3> &TerrainGenerator::GetGrass() { return grass_positions_; }
-
-std::vector<glm::vec3> &TerrainGenerator::GetHazelnuts() { return hazelnut_positions_; }
-
-void TerrainGenerator::generateHeightMap()
-{
-    height_map_ = NoiseGenerator::PerlinNoise2D(_grid_size_, _grid_size_, 6);
-}
-
-void TerrainGenerator::generateGrid()
-{
-    std::vector<glm::vec3> grid;
-    for (std::size_t i = 0; i < _grid_size_; i++)
-    {
-        for (std::size_t j = 0; j < _grid_size_; j++)
-        {
-            float x = (float)i / (float)_grid_size_;
-            float y = height_map_[i * _grid_size_ + j];
-            float z = (float)j / (float)_grid_size_;
-            grid.push_back(glm::vec3(x, y, z));
-        }
-    }
-
-    grid_ = std::make_shared<std::vector<glm::vec3>>(grid);
-}
-
-void TerrainGenerator::generateVertexPositions()
-{
-    // Construct quad from unique vertices first, then duplicate vertices.
-    // Why do this:
-    // a.) there is no need for an index buffer, and
-    // b.) each vertex can have its own normal.
-    // This does introduce a performance penalty, but I choose to ignore it for now.
-    //
-    int q0, q1, q2, q3;
-    for (std::size_t x = 0; x < _grid_size_ - 1; x++)
-    {
-        for (std::size_t y = 0; y < _grid_size_ - 1; y++)
-        {
-            q0 = x * _grid_size_ + y;
-            q1 = x * _grid_size_ + (y + 1);
-            q2 = (x + 1) * _grid_size_ + y;
-            q3 = (x + 1) * _grid_size_ + (y + 1);
-
-            // The indices of each triangle need to be in CCW order, since we've
-            // set GL_CCW as front face, and OpenGL will cull back faces.
-            //
-            glm::vec3 v0, v1, v2, v3;
-            v0 = grid_->at(q0);
-            v1 = grid_->at(q1);
-            v2 = grid_->at(q2);
-            v3 = grid_->at(q3);
-
-            glm::vec3 n1, n2;
-            n1 = calculateTriangleNormal(v0, v1, v2);
-            n2 = calculateTriangleNormal(v2, v1, v3);
-
-            positions_.push_back(v0);
-            normals_.push_back(n1);
-            positions_.push_back(v1);
-            normals_.push_back(n1);
-            positions_.push_back(v2);
-            normals_.push_back(n1);
-            positions_.push_back(v2);
-            normals_.push_back(n2);
-            positions_.push_back(v1);
-            normals_.push_back(n2);
-            positions_.push_back(v3);
-            normals_.push_back(n2);
-        }
-    }
-}
-
-void TerrainGenerator::generateVertexColors()
-{
-    glm::vec3 woodland_color(0.364f, 0.729f, 0.254f);
-
-    for (std::size_t i = 0; i < positions_.size(); i += 3)
-    {
-        colors_.push_back(woodland_color);
-        colors_.push_back(woodland_color);
-        colors_.push_back(woodland_color);
-    }
-}
-
-glm::vec3 TerrainGenerator::calculateTriangleNormal(glm::vec3 v0, glm::vec3 v1, glm::vec3 v2)
-{
-    glm::vec3 t0 = v0 - v1;
-    glm::vec3 t1 = v2 - v1;
-
-    // Calculate triangle normal. We want all three normals to be
-    // the same, so we get the low-poly shading effect
-    // when calculating lighting.
-    //
-    return glm::normalize(glm::cross(t1, t0));
-}
-
-void TerrainGenerator::generateVegetationPositions()
-{
-    std::mt19937 rnd_eng(std::random_device{}());
-    std::vector<glm::vec3> sample;
-
-    std::sample(grid_->begin(),
-                grid_->end(),
-                std::back_inserter(sample),
-                _grid_size_ * 38,
-                rnd_eng);
-    std::shuffle(sample.begin(), sample.end(), rnd_eng);
-
-    // Distribute the vegetation positions with the following ratio:
-    // 40% trees, 15% bushes, 10% rocks, 32% grass buds, 3% hazelnuts
-    //
-    std::copy(sample.begin(),
-              sample.begin() + sample.size() * 0.4,
-              std::back_inserter(tree_positions_));
-    std::copy(sample.begin() + sample.size() * 0.4,
-              sample.begin() + sample.size() * 0.55,
-              std::back_inserter(bush_positions_));
-    std::copy(sample.begin() + sample.size() * 0.55,
-              sample.begin() + sample.size() * 0.65,
-              std::back_inserter(rock_positions_));
-    std::copy(sample.begin() + sample.size() * 0.65,
-              sample.begin() + sample.size() * 0.97,
-              std::back_inserter(grass_positions_));
-    std::copy(sample.begin() + sample.size() * 0.97,
-              sample.end(),
-              std::back_inserter(hazelnut_positions_));
-}
+#include "Terrain/TerrainGenerator.h"
+
+// Grid rows per parallel task, like the row bands of NoiseGenerator.
+//
+const uint32_t TerrainGenerator::_ROWS_PER_TASK_ = 16;
+
+// Bumped on every change to the heights, the vegetation or their order.
+//
+const uint32_t TerrainGenerator::_VERSION_ = 3;
+
+TerrainGenerator::TerrainGenerator(const uint32_t _grid_size,
+                                   const HMSOURCEenum _height_map_source,
+                                   const uint32_t _seed,
+                                   const float _height_scale)
+    : _grid_size_(_grid_size), _height_map_source_(_height_map_source), _seed_(_seed),
+      _height_scale_(_height_scale)
+{
+    generateHeightMap();
+
+    // The vegetation only reads the heightfield, the vertex passes leave it alone. Its scatter
+    // runs serially, the vertex passes already use every core.
+    //
+    std::thread vegetation_thread([this]() {
+        Parallel::SetSerial(true);
+        generateVegetationPositions();
+    });
+    GridPositions(*heightfield_, positions_);
+    generateAmbientOcclusion();
+    vegetation_thread.join();
+}
+
+void TerrainGenerator::GridPositions(const Heightfield &_heightfield,
+                                     std::vector<glm::vec3> &positions)
+{
+    // One vertex per grid point, the triangles and their normals are built per LOD level by
+    // TerrainLod.
+    //
+    const uint32_t rows = _heightfield.GetRows();
+    const uint32_t cols = _heightfield.GetCols();
+    positions.resize((std::size_t)rows * cols);
+    Parallel::For(0, rows, _ROWS_PER_TASK_, [&](uint32_t row_begin, uint32_t row_end) {
+        for (uint32_t i = row_begin; i < row_end; i++)
+        {
+            glm::vec3 *row = &positions[(std::size_t)i * cols];
+            float x = (float)i / (float)rows;
+            for (uint32_t j = 0; j < cols; j++)
+            {
+                float z = (float)j / (float)rows;
+                row[j] = glm::vec3(x, _heightfield.At(i, j), z);
+            }
+        }
+    });
+}
+
+std::shared_ptr<Heightfield> TerrainGenerator::GetHeightfield() { return heightfield_; }
+
+std::vector<glm::vec3> &TerrainGenerator::GetPositions() { return positions_; }
+
+std::vector<uint8_t> &TerrainGenerator::GetAmbientOcclusion() { return ambient_occlusion_; }
+
+std::vector<glm::vec3> &TerrainGenerator::GetTrees() { return tree_positions_; }
+
+std::vector<glm::vec3> &TerrainGenerator::GetBushes() { return bush_positions_; }
+
+std::vector<glm::vec3> &TerrainGenerator::GetRocks() { return rock_positions_; }
+
+std::vector<glm::vec3> &TerrainGenerator::GetGrass() { return grass_positions_; }
+
+std::vector<glm::vec3> &TerrainGenerator::GetHazelnuts() { return hazelnut_positions_; }
+
+void TerrainGenerator::generateHeightMap()
+{
+    NoiseGenerator::Settings settings;
+    settings.seed = _seed_;
+    settings.octaves = 6;
+    settings.bias = 0.2f;
+    settings.pitch = (int)_grid_size_;
+    settings.wrap = 0;
+
+    heightfield_ = std::make_shared<Heightfield>(_grid_size_, _grid_size_);
+    if (_height_map_source_ == HMSOURCEenum::CPU)
+    {
+        // The noise bands are written straight into the heightfield.
+        //
+        NoiseGenerator::PerlinNoise2DTile(settings,
+                                          0,
+                                          0,
+                                          (int)_grid_size_,
+                                          (int)_grid_size_,
+                                          heightfield_->GetFloatData());
+        return;
+    }
+
+    // Needs a current GL context. Verification also generates the map on the CPU, so it
+    // is only worth it when checking a driver.
+    //
+    GpuNoiseGenerator gpu_noise(settings, _grid_size_, _grid_size_);
+    gpu_noise.Render();
+    if (_height_map_source_ == HMSOURCEenum::GPU_VERIFIED)
+    {
+        gpu_noise.Verify();
+    }
+    heightfield_->Assign(gpu_noise.ReadBack().get());
+}
+
+void TerrainGenerator::generateAmbientOcclusion()
+{
+    ambient_occlusion_.resize((std::size_t)_grid_size_ * _grid_size_);
+    AmbientOcclusion::Bake(*heightfield_,
+                           _height_scale_ * 0.5f,
+                           0,
+                           0,
+                           _grid_size_,
+                           _grid_size_,
+                           ambient_occlusion_.data());
+}
+
+void TerrainGenerator::generateVegetationPositions()
+{
+    // The mix of the whole map stays 38 plants per grid row, 40% trees, 15% bushes, 10% rocks,
+    // 32% grass buds and 3% hazelnuts. The layers are scattered in this order, the larger
+    // distances first, in grid units of 2 world units each.
+    //
+    const float cells = std::max(((float)_grid_size_ - 1.0f) * ((float)_grid_size_ - 1.0f), 1.0f);
+    const float density = (float)_grid_size_ * 38.0f / cells;
+    std::vector<VegetationScatter::Layer> layers = {
+        {0.40f * density, 1.5f},
+        {0.10f * density, 1.0f},
+        {0.15f * density, 1.0f},
+        {0.03f * density, 1.0f},
+        {0.32f * density, 0.5f},
+    };
+    VegetationScatter scatter(_grid_size_, _grid_size_, layers, _seed_ ^ 0x9e3779b9u);
+
+    std::vector<glm::vec3> *outputs[5] = {&tree_positions_,
+                                          &rock_positions_,
+                                          &bush_positions_,
+                                          &hazelnut_positions_,
+                                          &grass_positions_};
+    for (uint32_t layer = 0; layer < 5; layer++)
+    {
+        const std::vector<glm::vec2> &points = scatter.GetPoints(layer);
+        outputs[layer]->resize(points.size());
+        for (std::size_t k = 0; k < points.size(); k++)
+        {
+            outputs[layer]->at(k) = glm::vec3(points[k].x / (float)_grid_size_,
+                                              heightfield_->Sample(points[k].x, points[k].y),
+                                              points[k].y / (float)_grid_size_);
+        }
+    }
+
+    // Terrain picks the tree models by the order of the trees, the scatter returns them tile
+    // by tile.
+    //
+    std::mt19937 rnd_eng(NoiseGenerator::Hash(_seed_ ^ 0x9e3779b9u, 0, 0));
+    std::shuffle(tree_positions_.begin(), tree_positions_.end(), rnd_eng);
+}
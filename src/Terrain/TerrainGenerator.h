@@ -1,56 +1,86 @@
-#pragma once
-
-#include <algorithm>
-#include <iostream>
-#include <iterator>
-#include <random>
-#include <string>
-#include <vector>
-
-#include <glad/glad.h>
-#include <GLFW/glfw3.h>
-#include <glm/glm.hpp>
-#include <glm/gtc/matrix_transform.hpp>
-#include <glm/gtc/type_ptr.hpp>
-
-#include "Terrain/NoiseGenerator.h"
-
-class TerrainGenerator
-{
-public:
-    TerrainGenerator(const uint32_t _grid_size = 256);
-
-    std::shared_ptr<std::vector<glm::vec3>> GetGrid();
-
-    std::vector<glm::vec3> &GetPositions();
-    std::vector<glm::vec3> &GetNormals();
-    std::vector<glm::vec3> &GetColors();
-
-    std::vector<glm::vec3> &GetTrees();
-    std::vector<glm::vec3> &GetBushes();
-    std::vector<glm::vec3> &GetRocks();
-    std::vector<glm::vec3> &GetGrass();
-    std::vector<glm::vec3> &GetHazelnuts();
-
-private:
-    const uint32_t _grid_size_;
-    std::shared_ptr<float[]> height_map_;
-    std::shared_ptr<std::vector<glm::vec3>> grid_;
-
-    std::vector<glm::vec3> positions_;
-    std::vector<glm::vec3> normals_;
-    std::vector<glm::vec3> colors_;
-
-    std::vector<glm::vec3> tree_positions_;
-    std::vector<glm::vec3> bush_positions_;
-    std::vector<glm::vec3> rock_positions_;
-    std::vector<glm::vec3> grass_positions_;
-    std::vector<glm::vec3> hazelnut_positions_;
-
-    void generateHeightMap();
-    void generateGrid();
-    void generateVertexPositions();
-    void generateVertexColors();
-    void generateVegetationPositions();
-    glm::vec3 calculateTriangleNormal(glm::vec3 v0, glm::vec3 v1, glm::vec3 v2);
-};
+#pragma once
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "Application/Parallel.h"
+#include "Terrain/AmbientOcclusion.h"
+#include "Terrain/GpuNoiseGenerator.h"
+#include "Terrain/Heightfield.h"
+#include "Terrain/NoiseGenerator.h"
+#include "Terrain/VegetationScatter.h"
+#include "Types/EHeightMap.h"
+
+// Height map, grid vertices and vegetation of a terrain, fully determined by _seed.
+//
+// Every output is allocated at its final size and filled by passes over bands of grid rows on all
+// cores. The vegetation only depends on the heights, so it is scattered (see VegetationScatter) on
+// its own thread while the vertex positions are built and the ambient occlusion is baked (see
+// AmbientOcclusion) for a terrain _height_scale world units high, with a sample every 2 world
+// units. No stage depends on the thread count or the order the bands finish in, so the output is
+// the same as on a single core.
+//
+class TerrainGenerator
+{
+public:
+    // Changes whenever the same seed and grid size produce a different world, which
+    // invalidates the world snapshots written before.
+    //
+    static const uint32_t _VERSION_;
+
+    TerrainGenerator(const uint32_t _grid_size,
+                     const HMSOURCEenum _height_map_source,
+                     const uint32_t _seed,
+                     const float _height_scale);
+
+    // One vertex per sample of a unit heightfield, sample (i, j) at (i / rows, height, j / rows).
+    //
+    static void GridPositions(const Heightfield &_heightfield, std::vector<glm::vec3> &positions);
+
+    std::shared_ptr<Heightfield> GetHeightfield();
+
+    std::vector<glm::vec3> &GetPositions();
+
+    // One byte per grid point, row by row, 255 for an open sky.
+    //
+    std::vector<uint8_t> &GetAmbientOcclusion();
+
+    std::vector<glm::vec3> &GetTrees();
+    std::vector<glm::vec3> &GetBushes();
+    std::vector<glm::vec3> &GetRocks();
+    std::vector<glm::vec3> &GetGrass();
+    std::vector<glm::vec3> &GetHazelnuts();
+
+private:
+    const uint32_t _grid_size_;
+    const HMSOURCEenum _height_map_source_;
+    const uint32_t _seed_;
+    const float _height_scale_;
+    std::shared_ptr<Heightfield> heightfield_;
+
+    std::vector<glm::vec3> positions_;
+    std::vector<uint8_t> ambient_occlusion_;
+
+    std::vector<glm::vec3> tree_positions_;
+    std::vector<glm::vec3> bush_positions_;
+    std::vector<glm::vec3> rock_positions_;
+    std::vector<glm::vec3> grass_positions_;
+    std::vector<glm::vec3> hazelnut_positions_;
+
+    static const uint32_t _ROWS_PER_TASK_;
+
+    void generateHeightMap();
+    void generateAmbientOcclusion();
+    void generateVegetationPositions();
+};
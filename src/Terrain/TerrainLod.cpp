@@ -0,0 +1,1051 @@
+#include "Terrain/TerrainLod.h"
+
+// Quads per node side. Every node is drawn with (_PATCH_SIZE_ / 2)^2 quads per quadrant.
+//
+const uint32_t TerrainLod::_PATCH_SIZE_ = 16;
+
+// Fraction of a level's range after which its vertices start morphing to the next level.
+//
+const float TerrainLod::_MORPH_START_ = 0.7f;
+
+// Fraction of the height range added below and above it for the vertex buffer quantization,
+// so UpdateHeights can dig and raise beyond the generated heights.
+//
+const float TerrainLod::_HEIGHT_HEADROOM_ = 0.5f;
+
+TerrainLod::TerrainLod(const std::vector<glm::vec3> &_positions,
+                       const uint32_t _grid_size,
+                       const glm::mat4 &_world_transform,
+                       const float _base_range,
+                       const TERRAINRENDERenum _render_mode,
+                       const bool _upload_in_place,
+                       const TerrainLod::Vertex *_level_vertices,
+                       const std::size_t _level_vertex_count)
+    : _grid_size_(_grid_size), _world_transform_(_world_transform), _render_mode_(_render_mode),
+      _upload_in_place_(_upload_in_place), vertex_count_(0), byte_size_(0), is_uploaded_(false),
+      vao_(0), vbo_(0), ebo_(0), instance_vbo_(0), height_texture_(0)
+{
+    buildHeights(_positions);
+    buildLevels(_positions, _level_vertices, _level_vertex_count);
+    if (_render_mode_ == TERRAINRENDERenum::HEIGHT_TEXTURE)
+    {
+        buildHeightTexture();
+        buildInstancedPatch();
+    }
+    else
+    {
+        buildPatchIndices();
+    }
+
+    uint32_t node_count = 0;
+    for (std::size_t i = 0; i < levels_.size(); i++)
+    {
+        node_count += 1u << (2 * i);
+    }
+    nodes_.reserve(node_count);
+    buildNode((uint32_t)levels_.size() - 1, 0, 0);
+    buildRanges(_base_range);
+    byte_size_ = sizeof(TerrainLod::Vertex) * vertex_count_ + sizeof(uint32_t) * indices_.size() +
+                 sizeof(float) * heights_.size() + patch_vertices_.size() +
+                 sizeof(uint16_t) * patch_indices_.size();
+
+    if (_upload_in_place_)
+    {
+        Upload();
+    }
+}
+
+void TerrainLod::Upload()
+{
+    if (is_uploaded_)
+    {
+        return;
+    }
+    if (_render_mode_ == TERRAINRENDERenum::HEIGHT_TEXTURE)
+    {
+        setupHeightTexture();
+    }
+    else
+    {
+        setupBuffers();
+    }
+    is_uploaded_ = true;
+
+    // The data lives in the GL buffers and textures from now on. The vertex buffers are
+    // updated from the heights, so those are kept.
+    //
+    std::vector<TerrainLod::Vertex>().swap(vertices_);
+    std::vector<uint32_t>().swap(indices_);
+    if (_render_mode_ == TERRAINRENDERenum::HEIGHT_TEXTURE)
+    {
+        std::vector<float>().swap(heights_);
+    }
+    std::vector<uint8_t>().swap(patch_vertices_);
+    std::vector<uint16_t>().swap(patch_indices_);
+}
+
+std::vector<TerrainLod::Vertex> TerrainLod::ReadVertices()
+{
+    if (_render_mode_ == TERRAINRENDERenum::HEIGHT_TEXTURE || !is_uploaded_)
+    {
+        return vertices_;
+    }
+    std::vector<TerrainLod::Vertex> vertices(vertex_count_);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+    glGetBufferSubData(
+        GL_ARRAY_BUFFER, 0, sizeof(TerrainLod::Vertex) * vertex_count_, vertices.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return vertices;
+}
+
+void TerrainLod::Release()
+{
+    if (!is_uploaded_)
+    {
+        return;
+    }
+    glDeleteVertexArrays(1, &vao_);
+    glDeleteBuffers(1, &vbo_);
+    glDeleteBuffers(1, &ebo_);
+    vao_ = vbo_ = ebo_ = 0;
+    if (_render_mode_ == TERRAINRENDERenum::HEIGHT_TEXTURE)
+    {
+        glDeleteBuffers(1, &instance_vbo_);
+        glDeleteTextures(1, &height_texture_);
+        instance_vbo_ = height_texture_ = 0;
+    }
+    is_uploaded_ = false;
+}
+
+void TerrainLod::Draw(Shader &shader, const Camera &camera)
+{
+    if (!is_uploaded_)
+    {
+        return;
+    }
+
+    shader.Use();
+    shader.SetMat4("model", position_transform_);
+
+    Frustum frustum(camera.GetProjectionViewMatrix());
+    draw_items_.clear();
+    selectNode(0, frustum, camera.position_);
+
+    // Both triangles of a quad start with the vertex that carries their flat normals.
+    //
+    glProvokingVertex(GL_FIRST_VERTEX_CONVENTION);
+    if (_render_mode_ == TERRAINRENDERenum::HEIGHT_TEXTURE)
+    {
+        drawInstanced(shader);
+        glProvokingVertex(GL_LAST_VERTEX_CONVENTION);
+        return;
+    }
+
+    glBindVertexArray(vao_);
+    uint32_t current_level = std::numeric_limits<uint32_t>::max();
+    for (const DrawItem &item : draw_items_)
+    {
+        const Level &level = levels_[nodes_[item.node].level];
+        if (nodes_[item.node].level != current_level)
+        {
+            current_level = nodes_[item.node].level;
+            shader.SetVec2("morphRange", glm::vec2(_MORPH_START_ * level.range, level.range));
+        }
+        drawItem(item);
+    }
+    glBindVertexArray(0);
+    glProvokingVertex(GL_LAST_VERTEX_CONVENTION);
+}
+
+void TerrainLod::UpdateHeights(const uint32_t _i,
+                               const uint32_t _j,
+                               const uint32_t _rows,
+                               const uint32_t _cols,
+                               const float *_heights)
+{
+    if (_rows == 0 || _cols == 0 || _i + _rows > _grid_size_ || _j + _cols > _grid_size_)
+    {
+        std::cout << "ERROR::TERRAINLOD::UPDATE_HEIGHTS::REGION_OUT_OF_BOUNDS" << std::endl;
+        return;
+    }
+
+    if (!heights_.empty())
+    {
+        for (uint32_t i = 0; i < _rows; i++)
+        {
+            std::copy(_heights + (std::size_t)i * _cols,
+                      _heights + (std::size_t)(i + 1) * _cols,
+                      heights_.begin() + (std::size_t)(_i + i) * _grid_size_ + _j);
+        }
+    }
+
+    if (_render_mode_ == TERRAINRENDERenum::HEIGHT_TEXTURE)
+    {
+        if (is_uploaded_)
+        {
+            glBindTexture(GL_TEXTURE_2D, height_texture_);
+            glTexSubImage2D(GL_TEXTURE_2D,
+                            0,
+                            (GLint)_j,
+                            (GLint)_i,
+                            (GLsizei)_cols,
+                            (GLsizei)_rows,
+                            GL_RED,
+                            GL_FLOAT,
+                            _heights);
+            glBindTexture(GL_TEXTURE_2D, 0);
+        }
+    }
+    else
+    {
+        updateLevelVertices(_i, _j, _rows, _cols);
+    }
+
+    const std::size_t count = (std::size_t)_rows * _cols;
+    const float min_height = *std::min_element(_heights, _heights + count);
+    const float max_height = *std::max_element(_heights, _heights + count);
+    float y_1 = (_world_transform_ * glm::vec4(0.0f, min_height, 0.0f, 1.0f)).y;
+    float y_2 = (_world_transform_ * glm::vec4(0.0f, max_height, 0.0f, 1.0f)).y;
+    growBounds(0, _i, _j, _rows, _cols, std::min(y_1, y_2), std::max(y_1, y_2));
+}
+
+uint32_t TerrainLod::GetLevelCount() { return (uint32_t)levels_.size(); }
+
+uint32_t TerrainLod::GetDrawnNodeCount() { return (uint32_t)draw_items_.size(); }
+
+std::size_t TerrainLod::GetByteSize() { return byte_size_; }
+
+void TerrainLod::buildHeights(const std::vector<glm::vec3> &positions)
+{
+    // The grid is regular, so a grid point is fully described by its height.
+    //
+    const glm::vec3 origin = positions[0];
+    grid_origin_ = glm::vec2(origin.x, origin.z);
+    grid_spacing_ = _grid_size_ > 1 ? positions[_grid_size_].x - origin.x : 1.0f;
+    heights_.resize(positions.size());
+    for (std::size_t i = 0; i < positions.size(); i++)
+    {
+        heights_[i] = positions[i].y;
+    }
+}
+
+void TerrainLod::buildLevels(const std::vector<glm::vec3> &positions,
+                             const TerrainLod::Vertex *_level_vertices,
+                             const std::size_t _level_vertex_count)
+{
+    // The quadtree needs a power of two number of cells. The level grids are padded up to it
+    // by clamping to the last grid point, which only adds degenerate quads.
+    //
+    const uint32_t cells = _grid_size_ - 1;
+    uint32_t level_count = 1;
+    while ((_PATCH_SIZE_ << (level_count - 1)) < cells)
+    {
+        level_count++;
+    }
+    const uint32_t root_cells = _PATCH_SIZE_ << (level_count - 1);
+
+    if (_render_mode_ == TERRAINRENDERenum::HEIGHT_TEXTURE)
+    {
+        for (uint32_t l = 0; l < level_count; l++)
+        {
+            levels_.push_back({0, (root_cells >> l) + 1, 0, 0.0f});
+        }
+        return;
+    }
+
+    // Quantize relative to the bounding box so the full 16 bits cover the actual heights, plus
+    // the headroom for UpdateHeights.
+    //
+    glm::vec3 min_p(std::numeric_limits<float>::max());
+    glm::vec3 max_p(std::numeric_limits<float>::lowest());
+    for (const glm::vec3 &p : positions)
+    {
+        min_p = glm::min(min_p, p);
+        max_p = glm::max(max_p, p);
+    }
+    const float headroom = _HEIGHT_HEADROOM_ * (max_p.y - min_p.y);
+    min_p.y -= headroom;
+    max_p.y += headroom;
+    position_min_ = min_p;
+    position_extent_ = glm::max(max_p - min_p, glm::vec3(1e-6f));
+    position_transform_ = _world_transform_ * glm::translate(glm::mat4(1.0f), position_min_) *
+                          glm::scale(glm::mat4(1.0f), position_extent_);
+
+    for (uint32_t l = 0; l < level_count; l++)
+    {
+        Level level;
+        level.base_vertex = (uint32_t)vertex_count_;
+        level.pitch = (root_cells >> l) + 1;
+        level.first_index = 0;
+        level.range = 0.0f;
+        levels_.push_back(level);
+        vertex_count_ += (std::size_t)level.pitch * level.pitch;
+    }
+
+    // The quantization above only depends on the heights, so vertices built from the same
+    // heights before are still valid.
+    //
+    if (_level_vertices != nullptr)
+    {
+        if (_level_vertex_count == vertex_count_)
+        {
+            if (_upload_in_place_)
+            {
+                glGenBuffers(1, &vbo_);
+                glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+                glBufferData(GL_ARRAY_BUFFER,
+                             sizeof(TerrainLod::Vertex) * vertex_count_,
+                             _level_vertices,
+                             GL_STATIC_DRAW);
+                glBindBuffer(GL_ARRAY_BUFFER, 0);
+            }
+            else
+            {
+                vertices_.assign(_level_vertices, _level_vertices + vertex_count_);
+            }
+            return;
+        }
+        std::cout << "ERROR::TERRAINLOD::BUILD_LEVELS::VERTEX_COUNT_MISMATCH" << std::endl;
+    }
+
+    // In place, the buffer may be write-combined memory, so every vertex is assembled on the
+    // stack and stored with one write, and nothing is read back.
+    //
+    TerrainLod::Vertex *vertices = nullptr;
+    if (_upload_in_place_)
+    {
+        glGenBuffers(1, &vbo_);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+        glBufferData(
+            GL_ARRAY_BUFFER, sizeof(TerrainLod::Vertex) * vertex_count_, nullptr, GL_STATIC_DRAW);
+        vertices = (TerrainLod::Vertex *)glMapBufferRange(
+            GL_ARRAY_BUFFER,
+            0,
+            sizeof(TerrainLod::Vertex) * vertex_count_,
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        if (vertices == nullptr)
+        {
+            std::cout << "ERROR::TERRAINLOD::BUILD_LEVELS::MAP_FAILED" << std::endl;
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            return;
+        }
+    }
+    else
+    {
+        vertices_.resize(vertex_count_);
+        vertices = vertices_.data();
+    }
+
+    // The levels are all set up first, the vertices need the coarser pitches for their morph
+    // targets.
+    //
+    for (uint32_t l = 0; l < level_count; l++)
+    {
+        const uint32_t step = 1u << l;
+        const uint32_t pitch = levels_[l].pitch;
+        TerrainLod::Vertex *level_vertices = vertices + levels_[l].base_vertex;
+
+        TerrainLod::Vertex vertex;
+        for (uint32_t i = 0; i < pitch; i++)
+        {
+            for (uint32_t j = 0; j < pitch; j++)
+            {
+                glm::vec3 p = levelPosition(i, j, step);
+                glm::vec3 position = glm::clamp((p - position_min_) / position_extent_, 0.0f, 1.0f);
+                vertex.position[0] = (uint16_t)std::lround(position.x * 65535.0f);
+                vertex.position[2] = (uint16_t)std::lround(position.z * 65535.0f);
+                buildVertex(vertex, l, i, j);
+                level_vertices[i * pitch + j] = vertex;
+            }
+        }
+    }
+
+    if (_upload_in_place_)
+    {
+        // The contents are undefined if the buffer got lost while mapped, which only happens
+        // on mode switches and similar events.
+        //
+        if (glUnmapBuffer(GL_ARRAY_BUFFER) == GL_FALSE)
+        {
+            std::cout << "ERROR::TERRAINLOD::BUILD_LEVELS::UNMAP_FAILED" << std::endl;
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+}
+
+void TerrainLod::buildVertex(TerrainLod::Vertex &vertex,
+                             const uint32_t _level,
+                             const uint32_t _i,
+                             const uint32_t _j)
+{
+    // Everything of vertex (_i, _j) of a level that depends on the heights. Every grid point is
+    // stored once, the quads reference them through an index buffer. To keep the flat
+    // low-poly shading, both triangles of a quad start with the same vertex (q1), which is the
+    // provoking vertex under GL_FIRST_VERTEX_CONVENTION. That vertex carries the flat normals
+    // of both triangles and the fragment shader picks one by primitive parity. No two quads
+    // share their q1, so one vertex per grid point is enough. Vertex (i, j) is the q1 of quad
+    // (i, j - 1).
+    //
+    const uint32_t step = 1u << _level;
+    const uint32_t pitch = levels_[_level].pitch;
+    const bool has_coarser = _level + 1 < levels_.size();
+    glm::vec3 p = levelPosition(_i, _j, step);
+    vertex.position[1] = quantizeHeight(p.y);
+    vertex.position[3] = vertex.position[1];
+    packOctNormal(glm::vec3(0.0f, 1.0f, 0.0f), vertex.normal_1);
+    packOctNormal(glm::vec3(0.0f, 1.0f, 0.0f), vertex.normal_2);
+
+    const bool is_q1 = _j > 0 && _i + 1 < pitch;
+    if (is_q1)
+    {
+        const uint32_t i = _i;
+        const uint32_t j = _j - 1;
+        glm::vec3 v0 = levelPosition(i, j, step);
+        glm::vec3 v1 = levelPosition(i, j + 1, step);
+        glm::vec3 v2 = levelPosition(i + 1, j, step);
+        glm::vec3 v3 = levelPosition(i + 1, j + 1, step);
+        packOctNormal(calculateTriangleNormal(v0, v1, v2), vertex.normal_1);
+        packOctNormal(calculateTriangleNormal(v2, v1, v3), vertex.normal_2);
+
+        // Fully morphed, each triangle lies in the coarse triangle containing its centroid and
+        // takes that triangle's normal.
+        //
+        if (has_coarser)
+        {
+            glm::vec3 c0 = levelPosition(i / 2, j / 2, step * 2);
+            glm::vec3 c1 = levelPosition(i / 2, j / 2 + 1, step * 2);
+            glm::vec3 c2 = levelPosition(i / 2 + 1, j / 2, step * 2);
+            glm::vec3 c3 = levelPosition(i / 2 + 1, j / 2 + 1, step * 2);
+            glm::vec3 cn1 = calculateTriangleNormal(c0, c1, c2);
+            glm::vec3 cn2 = calculateTriangleNormal(c2, c1, c3);
+            glm::vec3 weights;
+            packOctNormal(barycentric((v0 + v1 + v2) / 3.0f, c0, c1, c2, weights) ? cn1 : cn2,
+                          vertex.morph_normal_1);
+            packOctNormal(barycentric((v2 + v1 + v3) / 3.0f, c0, c1, c2, weights) ? cn1 : cn2,
+                          vertex.morph_normal_2);
+        }
+    }
+    if (!has_coarser || !is_q1)
+    {
+        std::copy(vertex.normal_1, vertex.normal_1 + 2, vertex.morph_normal_1);
+        std::copy(vertex.normal_2, vertex.normal_2 + 2, vertex.morph_normal_2);
+    }
+    if (!has_coarser)
+    {
+        return;
+    }
+
+    // The morph target is the height of the coarse mesh at this grid point. For the points
+    // shared with the coarse grid that is their own height.
+    //
+    const uint32_t coarse_cells = (pitch - 1) / 2;
+    uint32_t ci = std::min(_i / 2, coarse_cells - 1);
+    uint32_t cj = std::min(_j / 2, coarse_cells - 1);
+    glm::vec3 c0 = levelPosition(ci, cj, step * 2);
+    glm::vec3 c1 = levelPosition(ci, cj + 1, step * 2);
+    glm::vec3 c2 = levelPosition(ci + 1, cj, step * 2);
+    glm::vec3 c3 = levelPosition(ci + 1, cj + 1, step * 2);
+    glm::vec3 weights;
+    float height = p.y;
+    if (barycentric(p, c0, c1, c2, weights))
+    {
+        height = glm::dot(weights, glm::vec3(c0.y, c1.y, c2.y));
+    }
+    else if (barycentric(p, c2, c1, c3, weights))
+    {
+        height = glm::dot(weights, glm::vec3(c2.y, c1.y, c3.y));
+    }
+    vertex.position[3] = quantizeHeight(height);
+}
+
+void TerrainLod::updateLevelVertices(const uint32_t _i,
+                                     const uint32_t _j,
+                                     const uint32_t _rows,
+                                     const uint32_t _cols)
+{
+    // Vertex k of a level reads the level grid points k - 2 to k + 2 (its quad, the coarse
+    // quads of both for the morph targets), which are the grid points k * step clamped to the
+    // grid. The last grid point also stands in for the whole padding.
+    //
+    const uint32_t last = _grid_size_ - 1;
+    for (uint32_t l = 0; l < levels_.size(); l++)
+    {
+        const Level &level = levels_[l];
+        const uint32_t step = 1u << l;
+        const uint32_t pitch = level.pitch;
+        const uint32_t i_0 = _i / step >= 2 ? _i / step - 2 : 0;
+        const uint32_t j_0 = _j / step >= 2 ? _j / step - 2 : 0;
+        const uint32_t i_1 =
+            _i + _rows - 1 >= last ? pitch - 1 : std::min((_i + _rows - 1) / step + 2, pitch - 1);
+        const uint32_t j_1 =
+            _j + _cols - 1 >= last ? pitch - 1 : std::min((_j + _cols - 1) / step + 2, pitch - 1);
+
+        // Before Upload the vertices are still on the CPU. Afterwards the rows are written
+        // into one mapped range without invalidating it, the untouched x and z bytes
+        // keep their contents, and only the written rows are flushed.
+        //
+        const std::size_t first = (std::size_t)level.base_vertex + (std::size_t)i_0 * pitch + j_0;
+        const std::size_t count = (std::size_t)(i_1 - i_0) * pitch + (j_1 - j_0 + 1);
+        TerrainLod::Vertex *mapped = nullptr;
+        if (is_uploaded_)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+            mapped = (TerrainLod::Vertex *)glMapBufferRange(
+                GL_ARRAY_BUFFER,
+                (GLintptr)(sizeof(TerrainLod::Vertex) * first),
+                (GLsizeiptr)(sizeof(TerrainLod::Vertex) * count),
+                GL_MAP_WRITE_BIT | GL_MAP_FLUSH_EXPLICIT_BIT);
+            if (mapped == nullptr)
+            {
+                std::cout << "ERROR::TERRAINLOD::UPDATE_LEVEL_VERTICES::MAP_FAILED" << std::endl;
+                glBindBuffer(GL_ARRAY_BUFFER, 0);
+                return;
+            }
+        }
+        else
+        {
+            mapped = vertices_.data() + first;
+        }
+
+        TerrainLod::Vertex vertex;
+        for (uint32_t i = i_0; i <= i_1; i++)
+        {
+            TerrainLod::Vertex *row = mapped + (std::size_t)(i - i_0) * pitch;
+            for (uint32_t j = j_0; j <= j_1; j++)
+            {
+                buildVertex(vertex, l, i, j);
+                TerrainLod::Vertex &target = row[j - j_0];
+                target.position[1] = vertex.position[1];
+                target.position[3] = vertex.position[3];
+                std::copy(vertex.normal_1, vertex.normal_1 + 2, target.normal_1);
+                std::copy(vertex.normal_2, vertex.normal_2 + 2, target.normal_2);
+                std::copy(vertex.morph_normal_1, vertex.morph_normal_1 + 2, target.morph_normal_1);
+                std::copy(vertex.morph_normal_2, vertex.morph_normal_2 + 2, target.morph_normal_2);
+            }
+            if (is_uploaded_)
+            {
+                const std::size_t row_offset = sizeof(TerrainLod::Vertex) * (i - i_0) * pitch;
+                const std::size_t row_size = sizeof(TerrainLod::Vertex) * (j_1 - j_0 + 1);
+                glFlushMappedBufferRange(
+                    GL_ARRAY_BUFFER, (GLintptr)row_offset, (GLsizeiptr)row_size);
+            }
+        }
+
+        if (is_uploaded_)
+        {
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+    }
+}
+
+void TerrainLod::buildPatchIndices()
+{
+    // Quadrant q covers the quads [qx, qx + half) x [qy, qy + half) with qx = (q >> 1) * half
+    // and qy = (q & 1) * half, which matches the order of Node::children.
+    //
+    const uint32_t half = _PATCH_SIZE_ / 2;
+    for (Level &level : levels_)
+    {
+        level.first_index = (uint32_t)indices_.size();
+        const uint32_t pitch = level.pitch;
+
+        uint32_t q0, q1, q2, q3;
+        for (uint32_t q = 0; q < 4; q++)
+        {
+            for (uint32_t x = (q >> 1) * half; x < (q >> 1) * half + half; x++)
+            {
+                for (uint32_t y = (q & 1) * half; y < (q & 1) * half + half; y++)
+                {
+                    q0 = x * pitch + y;
+                    q1 = x * pitch + (y + 1);
+                    q2 = (x + 1) * pitch + y;
+                    q3 = (x + 1) * pitch + (y + 1);
+
+                    // (v0, v1, v2) and (v2, v1, v3) in CCW order, rotated so that both begin
+                    // with v1.
+                    //
+                    indices_.push_back(q1);
+                    indices_.push_back(q2);
+                    indices_.push_back(q0);
+                    indices_.push_back(q1);
+                    indices_.push_back(q3);
+                    indices_.push_back(q2);
+                }
+            }
+        }
+    }
+}
+
+void TerrainLod::buildHeightTexture()
+{
+    // The shader rebuilds the position of a grid point from the grid spacing, the rest goes
+    // into the model matrix.
+    //
+    position_min_ = glm::vec3(grid_origin_.x, 0.0f, grid_origin_.y);
+    position_extent_ = glm::vec3(grid_spacing_, 1.0f, grid_spacing_);
+    position_transform_ = _world_transform_ * glm::translate(glm::mat4(1.0f), position_min_);
+}
+
+void TerrainLod::buildInstancedPatch()
+{
+    // One quadrant of a patch, (_PATCH_SIZE_ / 2)^2 quads. Every drawn quadrant of every level
+    // is an instance of it. The triangles are ordered as in buildPatchIndices, so
+    // gl_PrimitiveID keeps its parity and the shader finds the quad of its q1 at j - 1.
+    //
+    const uint32_t half = _PATCH_SIZE_ / 2;
+    const uint32_t pitch = half + 1;
+    for (uint32_t i = 0; i < pitch; i++)
+    {
+        for (uint32_t j = 0; j < pitch; j++)
+        {
+            patch_vertices_.push_back((uint8_t)i);
+            patch_vertices_.push_back((uint8_t)j);
+        }
+    }
+
+    uint16_t q0, q1, q2, q3;
+    for (uint32_t x = 0; x < half; x++)
+    {
+        for (uint32_t y = 0; y < half; y++)
+        {
+            q0 = (uint16_t)(x * pitch + y);
+            q1 = (uint16_t)(x * pitch + (y + 1));
+            q2 = (uint16_t)((x + 1) * pitch + y);
+            q3 = (uint16_t)((x + 1) * pitch + (y + 1));
+            patch_indices_.insert(patch_indices_.end(), {q1, q2, q0, q1, q3, q2});
+        }
+    }
+}
+
+int32_t TerrainLod::buildNode(const uint32_t _level, const uint32_t _x, const uint32_t _y)
+{
+    // Nodes that lie completely in the padding are left out.
+    //
+    const uint32_t cells = _grid_size_ - 1;
+    if (_x >= cells || _y >= cells)
+    {
+        return -1;
+    }
+
+    const int32_t index = (int32_t)nodes_.size();
+    nodes_.push_back(Node());
+    nodes_[index].level = _level;
+    nodes_[index].x = _x;
+    nodes_[index].y = _y;
+    std::fill(nodes_[index].children, nodes_[index].children + 4, -1);
+
+    glm::vec3 min_p(std::numeric_limits<float>::max());
+    glm::vec3 max_p(std::numeric_limits<float>::lowest());
+    const uint32_t size = _PATCH_SIZE_ << _level;
+    if (_level == 0)
+    {
+        for (uint32_t i = _x; i <= std::min(_x + size, cells); i++)
+        {
+            for (uint32_t j = _y; j <= std::min(_y + size, cells); j++)
+            {
+                glm::vec4 position = glm::vec4(levelPosition(i, j, 1), 1.0f);
+                glm::vec3 p = glm::vec3(_world_transform_ * position);
+                min_p = glm::min(min_p, p);
+                max_p = glm::max(max_p, p);
+            }
+        }
+    }
+    else
+    {
+        const uint32_t half = size / 2;
+        for (uint32_t q = 0; q < 4; q++)
+        {
+            int32_t child = buildNode(_level - 1, _x + (q >> 1) * half, _y + (q & 1) * half);
+            nodes_[index].children[q] = child;
+            if (child >= 0)
+            {
+                AABB box = nodes_[child].bounds;
+                min_p = glm::min(min_p, glm::vec3(box.XMin(), box.YMin(), box.ZMin()));
+                max_p = glm::max(max_p, glm::vec3(box.XMax(), box.YMax(), box.ZMax()));
+            }
+        }
+    }
+
+    glm::vec3 half_dims = (max_p - min_p) * 0.5f;
+    nodes_[index].bounds = AABB(min_p + half_dims, half_dims.x, half_dims.y, half_dims.z);
+    return index;
+}
+
+void TerrainLod::buildRanges(const float _base_range)
+{
+    // A node at level l is drawn if it is out of range of level l - 1, while its parent was
+    // in range of level l. For its neighbours to be at most one level apart, the range of
+    // level l has to exceed the diagonal of a level l + 1 node. The ranges double with each
+    // level, as do the node sizes, so it is enough to check level 0.
+    //
+    float diagonal = 0.0f;
+    for (Node &node : nodes_)
+    {
+        if (node.level == std::min(1u, (uint32_t)levels_.size() - 1))
+        {
+            glm::vec3 half_dims(
+                node.bounds.x_half_dim, node.bounds.y_half_dim, node.bounds.z_half_dim);
+            diagonal = std::max(diagonal, 2.0f * glm::length(half_dims));
+        }
+    }
+
+    float range = _base_range > 0.0f ? _base_range : 1.1f * diagonal;
+    for (Level &level : levels_)
+    {
+        level.range = range;
+        range *= 2.0f;
+    }
+}
+
+void TerrainLod::setupBuffers()
+{
+    glGenVertexArrays(1, &vao_);
+    glGenBuffers(1, &ebo_);
+
+    glBindVertexArray(vao_);
+
+    // Built in place, the vertices are already in the buffer.
+    //
+    if (vbo_ == 0)
+    {
+        glGenBuffers(1, &vbo_);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+        glBufferData(GL_ARRAY_BUFFER,
+                     sizeof(TerrainLod::Vertex) * vertices_.size(),
+                     vertices_.data(),
+                     GL_STATIC_DRAW);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo_);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                 sizeof(uint32_t) * indices_.size(),
+                 indices_.data(),
+                 GL_STATIC_DRAW);
+
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0,
+                          4,
+                          GL_UNSIGNED_SHORT,
+                          GL_TRUE,
+                          sizeof(TerrainLod::Vertex),
+                          (const void *)offsetof(TerrainLod::Vertex, position));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1,
+                          2,
+                          GL_BYTE,
+                          GL_TRUE,
+                          sizeof(TerrainLod::Vertex),
+                          (const void *)offsetof(TerrainLod::Vertex, normal_1));
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2,
+                          2,
+                          GL_BYTE,
+                          GL_TRUE,
+                          sizeof(TerrainLod::Vertex),
+                          (const void *)offsetof(TerrainLod::Vertex, normal_2));
+    glEnableVertexAttribArray(4);
+    glVertexAttribPointer(4,
+                          2,
+                          GL_BYTE,
+                          GL_TRUE,
+                          sizeof(TerrainLod::Vertex),
+                          (const void *)offsetof(TerrainLod::Vertex, morph_normal_1));
+    glEnableVertexAttribArray(5);
+    glVertexAttribPointer(5,
+                          2,
+                          GL_BYTE,
+                          GL_TRUE,
+                          sizeof(TerrainLod::Vertex),
+                          (const void *)offsetof(TerrainLod::Vertex, morph_normal_2));
+
+    glBindVertexArray(0);
+}
+
+void TerrainLod::setupHeightTexture()
+{
+    glGenVertexArrays(1, &vao_);
+    glGenBuffers(1, &vbo_);
+    glGenBuffers(1, &ebo_);
+    glGenBuffers(1, &instance_vbo_);
+
+    glBindVertexArray(vao_);
+
+    glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+    glBufferData(GL_ARRAY_BUFFER, patch_vertices_.size(), patch_vertices_.data(), GL_STATIC_DRAW);
+    glEnableVertexAttribArray(0);
+    glVertexAttribIPointer(0, 2, GL_UNSIGNED_BYTE, 2 * sizeof(uint8_t), (const void *)0);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo_);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                 sizeof(uint16_t) * patch_indices_.size(),
+                 patch_indices_.data(),
+                 GL_STATIC_DRAW);
+
+    glBindBuffer(GL_ARRAY_BUFFER, instance_vbo_);
+    glBufferData(GL_ARRAY_BUFFER, 0, nullptr, GL_STREAM_DRAW);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(glm::vec4), (const void *)0);
+    glVertexAttribDivisor(1, 1);
+
+    glBindVertexArray(0);
+
+    glGenTextures(1, &height_texture_);
+    glBindTexture(GL_TEXTURE_2D, height_texture_);
+    glTexImage2D(GL_TEXTURE_2D,
+                 0,
+                 GL_R32F,
+                 (GLsizei)_grid_size_,
+                 (GLsizei)_grid_size_,
+                 0,
+                 GL_RED,
+                 GL_FLOAT,
+                 heights_.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void TerrainLod::selectNode(const uint32_t _node,
+                            const Frustum &frustum,
+                            const glm::vec3 &camera_pos)
+{
+    const Node &node = nodes_[_node];
+    if (!frustum.Intersects(node.bounds))
+    {
+        return;
+    }
+
+    if (node.level == 0 || !inRange(node.bounds, camera_pos, levels_[node.level - 1].range))
+    {
+        draw_items_.push_back({_node, 0xF});
+        return;
+    }
+
+    // Quadrants whose child is in range of the finer level are drawn by the child, the
+    // others by this node.
+    //
+    uint32_t quadrants = 0;
+    for (uint32_t q = 0; q < 4; q++)
+    {
+        int32_t child = node.children[q];
+        if (child < 0)
+        {
+            continue;
+        }
+        if (inRange(nodes_[child].bounds, camera_pos, levels_[node.level - 1].range))
+        {
+            selectNode((uint32_t)child, frustum, camera_pos);
+        }
+        else if (frustum.Intersects(nodes_[child].bounds))
+        {
+            quadrants |= 1u << q;
+        }
+    }
+
+    if (quadrants != 0)
+    {
+        draw_items_.push_back({_node, quadrants});
+    }
+}
+
+bool TerrainLod::inRange(AABB box, const glm::vec3 &camera_pos, const float _range)
+{
+    glm::vec3 box_min(box.XMin(), box.YMin(), box.ZMin());
+    glm::vec3 box_max(box.XMax(), box.YMax(), box.ZMax());
+    glm::vec3 d = glm::max(glm::max(box_min - camera_pos, camera_pos - box_max), glm::vec3(0.0f));
+    return glm::dot(d, d) <= _range * _range;
+}
+
+void TerrainLod::drawItem(const DrawItem &item)
+{
+    const Node &node = nodes_[item.node];
+    const Level &level = levels_[node.level];
+    const GLint base_vertex =
+        (GLint)(level.base_vertex + (node.x >> node.level) * level.pitch + (node.y >> node.level));
+    const uint32_t quadrant_indices = (_PATCH_SIZE_ / 2) * (_PATCH_SIZE_ / 2) * 6;
+
+    // Adjacent quadrants are contiguous in the index buffer and drawn together.
+    //
+    uint32_t q = 0;
+    while (q < 4)
+    {
+        if ((item.quadrants & (1u << q)) == 0)
+        {
+            q++;
+            continue;
+        }
+        uint32_t first = q;
+        while (q < 4 && (item.quadrants & (1u << q)) != 0)
+        {
+            q++;
+        }
+        glDrawElementsBaseVertex(
+            GL_TRIANGLES,
+            (GLsizei)((q - first) * quadrant_indices),
+            GL_UNSIGNED_INT,
+            (const void *)(sizeof(uint32_t) * (level.first_index + first * quadrant_indices)),
+            base_vertex);
+    }
+}
+
+void TerrainLod::drawInstanced(Shader &shader)
+{
+    const uint32_t half = _PATCH_SIZE_ / 2;
+    instances_.clear();
+    for (const DrawItem &item : draw_items_)
+    {
+        const Node &node = nodes_[item.node];
+        const uint32_t step = 1u << node.level;
+        for (uint32_t q = 0; q < 4; q++)
+        {
+            if ((item.quadrants & (1u << q)) != 0)
+            {
+                instances_.push_back(glm::vec4((float)(node.x + (q >> 1) * half * step),
+                                               (float)(node.y + (q & 1) * half * step),
+                                               (float)step,
+                                               (float)node.level));
+            }
+        }
+    }
+    if (instances_.empty())
+    {
+        return;
+    }
+
+    shader.SetInt("gridSize", (int)_grid_size_);
+    shader.SetFloat("gridSpacing", position_extent_.x);
+    shader.SetInt("levelCount", (int)levels_.size());
+    for (std::size_t l = 0; l < levels_.size(); l++)
+    {
+        shader.SetVec2("morphRanges[" + std::to_string(l) + "]",
+                       glm::vec2(_MORPH_START_ * levels_[l].range, levels_[l].range));
+    }
+    shader.SetInt("heightMap", 0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, height_texture_);
+
+    // Orphan the instance buffer, the driver may still read last frame's instances.
+    //
+    glBindBuffer(GL_ARRAY_BUFFER, instance_vbo_);
+    glBufferData(GL_ARRAY_BUFFER,
+                 sizeof(glm::vec4) * instances_.size(),
+                 instances_.data(),
+                 GL_STREAM_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glBindVertexArray(vao_);
+    glDrawElementsInstanced(GL_TRIANGLES,
+                            (GLsizei)(half * half * 6),
+                            GL_UNSIGNED_SHORT,
+                            (const void *)0,
+                            (GLsizei)instances_.size());
+    glBindVertexArray(0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void TerrainLod::growBounds(const uint32_t _node,
+                            const uint32_t _i,
+                            const uint32_t _j,
+                            const uint32_t _rows,
+                            const uint32_t _cols,
+                            const float _min_height,
+                            const float _max_height)
+{
+    Node &node = nodes_[_node];
+    const uint32_t size = _PATCH_SIZE_ << node.level;
+    if (_i > node.x + size || _i + _rows <= node.x || _j > node.y + size || _j + _cols <= node.y)
+    {
+        return;
+    }
+
+    float y_min = std::min(node.bounds.YMin(), _min_height);
+    float y_max = std::max(node.bounds.YMax(), _max_height);
+    glm::vec3 center = node.bounds.GetCenter();
+    node.bounds = AABB(glm::vec3(center.x, 0.5f * (y_min + y_max), center.z),
+                       node.bounds.x_half_dim,
+                       0.5f * (y_max - y_min),
+                       node.bounds.z_half_dim);
+
+    for (int32_t child : node.children)
+    {
+        if (child >= 0)
+        {
+            growBounds((uint32_t)child, _i, _j, _rows, _cols, _min_height, _max_height);
+        }
+    }
+}
+
+uint32_t TerrainLod::sourceIndex(const uint32_t _i, const uint32_t _step)
+{
+    return std::min(_i * _step, _grid_size_ - 1);
+}
+
+glm::vec3 TerrainLod::levelPosition(const uint32_t _i, const uint32_t _j, const uint32_t _step)
+{
+    const uint32_t i = sourceIndex(_i, _step);
+    const uint32_t j = sourceIndex(_j, _step);
+    return glm::vec3(grid_origin_.x + (float)i * grid_spacing_,
+                     heights_[(std::size_t)i * _grid_size_ + j],
+                     grid_origin_.y + (float)j * grid_spacing_);
+}
+
+glm::vec3 TerrainLod::calculateTriangleNormal(glm::vec3 v0, glm::vec3 v1, glm::vec3 v2)
+{
+    // Quads in the padding collapse to lines and get an up facing normal.
+    //
+    glm::vec3 normal = glm::cross(v2 - v1, v0 - v1);
+    if (glm::dot(normal, normal) <= std::numeric_limits<float>::min())
+    {
+        return glm::vec3(0.0f, 1.0f, 0.0f);
+    }
+    return glm::normalize(normal);
+}
+
+bool TerrainLod::barycentric(glm::vec3 p, glm::vec3 a, glm::vec3 b, glm::vec3 c, glm::vec3 &weights)
+{
+    // Barycentric coordinates of p in the XZ projection of the triangle (a, b, c). Returns
+    // false if p lies outside or the triangle is degenerate.
+    //
+    glm::vec2 e0(b.x - a.x, b.z - a.z);
+    glm::vec2 e1(c.x - a.x, c.z - a.z);
+    glm::vec2 e2(p.x - a.x, p.z - a.z);
+    float denominator = e0.x * e1.y - e1.x * e0.y;
+    if (std::abs(denominator) <= std::numeric_limits<float>::min())
+    {
+        return false;
+    }
+    weights.y = (e2.x * e1.y - e1.x * e2.y) / denominator;
+    weights.z = (e0.x * e2.y - e2.x * e0.y) / denominator;
+    weights.x = 1.0f - weights.y - weights.z;
+
+    const float epsilon = -1e-4f;
+    return weights.x >= epsilon && weights.y >= epsilon && weights.z >= epsilon;
+}
+
+uint16_t TerrainLod::quantizeHeight(const float _height)
+{
+    float height = glm::clamp((_height - position_min_.y) / position_extent_.y, 0.0f, 1.0f);
+    return (uint16_t)std::lround(height * 65535.0f);
+}
+
+void TerrainLod::packOctNormal(const glm::vec3 &_normal, int8_t *_packed)
+{
+    // Project onto the octahedron |x| + |y| + |z| = 1 and unfold the lower half around +y,
+    // the decoding counterpart is OctDecode in lowPolyTerrain.vert.
+    //
+    glm::vec3 n = _normal / (std::abs(_normal.x) + std::abs(_normal.y) + std::abs(_normal.z));
+    glm::vec2 oct(n.x, n.z);
+    if (n.y < 0.0f)
+    {
+        oct = (1.0f - glm::abs(glm::vec2(n.z, n.x))) *
+              glm::vec2(n.x >= 0.0f ? 1.0f : -1.0f, n.z >= 0.0f ? 1.0f : -1.0f);
+    }
+    _packed[0] = (int8_t)std::lround(glm::clamp(oct.x, -1.0f, 1.0f) * 127.0f);
+    _packed[1] = (int8_t)std::lround(glm::clamp(oct.y, -1.0f, 1.0f) * 127.0f);
+}
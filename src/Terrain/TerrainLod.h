@@ -0,0 +1,207 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "Renderer/Camera.h"
+#include "Renderer/Shader.h"
+#include "Types/AABB.h"
+#include "Types/ETerrain.h"
+#include "Types/Frustum.h"
+
+// Continuous distance-based LOD (CDLOD) for the terrain grid.
+//
+// Every LOD level is the height map sampled at every 2^level-th grid point and is stored once
+// in a shared vertex buffer. A quadtree of nodes covers the map, a node at level L spans
+// _PATCH_SIZE_ quads of level L. All nodes of a level are drawn with the same patch index
+// range, offset into the level grid with a base vertex. The patch indices are ordered by
+// quadrant, so a node whose other quadrants are covered by finer children draws only the
+// remaining ones.
+//
+// Construction only builds the vertex and index data on the CPU, so it may run on any thread.
+// Upload creates the GL buffers and has to be called on the thread owning the GL context.
+// Constructed with _upload_in_place on that thread, the vertex buffer is allocated first and
+// every vertex is written once, straight into the mapped buffer, without a CPU copy of the
+// level grids. The terrain is then uploaded when the constructor returns.
+//
+// Each vertex also stores its height and flat normals as they are on the next coarser level.
+// The vertex shader morphs towards them with the distance to the camera, so a node is
+// geometrically identical to its coarser neighbour where they meet and no cracks appear.
+//
+// With TERRAINRENDERenum::HEIGHT_TEXTURE no level grids are built. The heights go to a texture
+// and every selected node quadrant is an instance of one small grid patch, which
+// lowPolyTerrainHeightMap.vert displaces. The geometry memory is then O(patch) instead of
+// O(map), and UpdateHeights only has to replace the edited texels.
+//
+// Neither mode stores colors, lowPolyTerrain.frag picks them from the height and slope.
+//
+// With TERRAINRENDERenum::VERTEX_BUFFER the heights stay on the CPU after Upload. UpdateHeights
+// recomputes the vertices of every level that depend on the edited grid points and writes
+// them through one mapped range per level, flushing only the touched rows.
+//
+class TerrainLod
+{
+public:
+    // 16 bytes. position is normalized to the bounding box of the terrain (see
+    // position_transform_), the fourth component is the morph target height. The normals
+    // are octahedron encoded around +y. normal_1 and normal_2 are the flat normals of the
+    // two triangles of the quad this vertex is the provoking vertex of.
+    //
+    struct Vertex
+    {
+        uint16_t position[4];
+        int8_t normal_1[2];
+        int8_t normal_2[2];
+        int8_t morph_normal_1[2];
+        int8_t morph_normal_2[2];
+    };
+
+    // _base_range is the LOD range of level 0. Terrains drawn next to each other need the same
+    // ranges to match at their borders, 0 derives it from the node sizes.
+    //
+    // _level_vertices are the level grids of an earlier TerrainLod of the same _positions, as
+    // returned by ReadVertices, usually mapped from a world snapshot. With VERTEX_BUFFER they
+    // replace building the level grids and are uploaded from where they are. They are ignored
+    // if their count does not match.
+    //
+    TerrainLod(const std::vector<glm::vec3> &_positions,
+               const uint32_t _grid_size,
+               const glm::mat4 &_world_transform,
+               const float _base_range = 0.0f,
+               const TERRAINRENDERenum _render_mode = TERRAINRENDERenum::VERTEX_BUFFER,
+               const bool _upload_in_place = false,
+               const TerrainLod::Vertex *_level_vertices = nullptr,
+               const std::size_t _level_vertex_count = 0);
+
+    void Upload();
+    void Release();
+    void Draw(Shader &shader, const Camera &camera);
+
+    // The level grids of VERTEX_BUFFER mode, read back from the vertex buffer once uploaded.
+    // Empty in HEIGHT_TEXTURE mode.
+    //
+    std::vector<TerrainLod::Vertex> ReadVertices();
+
+    // Replaces the heights of the grid points [_i, _i + _rows) x [_j, _j + _cols), given row
+    // by row in the units of _positions. The work is proportional to the region. Heights
+    // outside of the vertex buffer quantization range are clamped to it. The node bounds only
+    // grow, so they stay conservative when the terrain is lowered.
+    //
+    void UpdateHeights(const uint32_t _i,
+                       const uint32_t _j,
+                       const uint32_t _rows,
+                       const uint32_t _cols,
+                       const float *_heights);
+
+    uint32_t GetLevelCount();
+    uint32_t GetDrawnNodeCount();
+    std::size_t GetByteSize();
+
+private:
+    struct Node
+    {
+        AABB bounds;
+        uint32_t level;
+        uint32_t x, y;
+        int32_t children[4];
+    };
+
+    struct Level
+    {
+        uint32_t base_vertex;
+        uint32_t pitch;
+        uint32_t first_index;
+        float range;
+    };
+
+    struct DrawItem
+    {
+        uint32_t node;
+        uint32_t quadrants;
+    };
+
+    const uint32_t _grid_size_;
+    const glm::mat4 _world_transform_;
+    const TERRAINRENDERenum _render_mode_;
+    const bool _upload_in_place_;
+
+    glm::mat4 position_transform_;
+    glm::vec3 position_min_, position_extent_;
+    glm::vec2 grid_origin_;
+    float grid_spacing_;
+
+    std::vector<Level> levels_;
+    std::vector<Node> nodes_;
+    std::vector<DrawItem> draw_items_;
+    std::vector<TerrainLod::Vertex> vertices_;
+    std::vector<uint32_t> indices_;
+    std::size_t vertex_count_;
+
+    // The heights of all grid points in the units of _positions. The x and z coordinates
+    // follow from grid_origin_ and grid_spacing_.
+    //
+    std::vector<float> heights_;
+
+    // HEIGHT_TEXTURE mode only. The patch vertices are (i, j) grid offsets, the instances are
+    // (level 0 grid point i, j, step, level) of the drawn quadrants.
+    //
+    std::vector<uint8_t> patch_vertices_;
+    std::vector<uint16_t> patch_indices_;
+    std::vector<glm::vec4> instances_;
+
+    std::size_t byte_size_;
+    bool is_uploaded_;
+    uint32_t vao_, vbo_, ebo_;
+    uint32_t instance_vbo_, height_texture_;
+
+    static const uint32_t _PATCH_SIZE_;
+    static const float _MORPH_START_;
+    static const float _HEIGHT_HEADROOM_;
+
+    void buildHeights(const std::vector<glm::vec3> &positions);
+    void buildLevels(const std::vector<glm::vec3> &positions,
+                     const TerrainLod::Vertex *_level_vertices,
+                     const std::size_t _level_vertex_count);
+    void buildPatchIndices();
+    void buildHeightTexture();
+    void buildInstancedPatch();
+    int32_t buildNode(const uint32_t _level, const uint32_t _x, const uint32_t _y);
+    void buildVertex(TerrainLod::Vertex &vertex,
+                     const uint32_t _level,
+                     const uint32_t _i,
+                     const uint32_t _j);
+    void updateLevelVertices(const uint32_t _i,
+                             const uint32_t _j,
+                             const uint32_t _rows,
+                             const uint32_t _cols);
+    void buildRanges(const float _base_range);
+    void setupBuffers();
+    void setupHeightTexture();
+    void selectNode(const uint32_t _node, const Frustum &frustum, const glm::vec3 &camera_pos);
+    bool inRange(AABB box, const glm::vec3 &camera_pos, const float _range);
+    void drawItem(const DrawItem &item);
+    void drawInstanced(Shader &shader);
+    void growBounds(const uint32_t _node,
+                    const uint32_t _i,
+                    const uint32_t _j,
+                    const uint32_t _rows,
+                    const uint32_t _cols,
+                    const float _min_height,
+                    const float _max_height);
+
+    uint32_t sourceIndex(const uint32_t _i, const uint32_t _step);
+    glm::vec3 levelPosition(const uint32_t _i, const uint32_t _j, const uint32_t _step);
+    glm::vec3 calculateTriangleNormal(glm::vec3 v0, glm::vec3 v1, glm::vec3 v2);
+    bool barycentric(glm::vec3 p, glm::vec3 a, glm::vec3 b, glm::vec3 c, glm::vec3 &weights);
+    uint16_t quantizeHeight(const float _height);
+    void packOctNormal(const glm::vec3 &_normal, int8_t *_packed);
+};
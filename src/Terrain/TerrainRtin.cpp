@@ -0,0 +1,281 @@
+#include "Terrain/TerrainRtin.h"
+
+TerrainRtin::TerrainRtin(const std::vector<glm::vec3> &_positions,
+                         const uint32_t _grid_size,
+                         const glm::mat4 &_world_transform,
+                         const float _max_error)
+    : _grid_size_(_grid_size), _world_transform_(_world_transform), _max_error_(_max_error),
+      rtin_size_(2), vertex_count_(0), index_count_(0), is_uploaded_(false), vao_(0), vbo_(0),
+      ebo_(0)
+{
+    while (rtin_size_ < _grid_size_ - 1)
+    {
+        rtin_size_ *= 2;
+    }
+    rtin_size_ += 1;
+
+    computeErrors(_positions);
+    buildMesh(_positions);
+
+    // Only needed while building.
+    //
+    std::vector<float>().swap(errors_);
+    std::vector<uint32_t>().swap(vertex_map_);
+}
+
+void TerrainRtin::Upload()
+{
+    if (is_uploaded_)
+    {
+        return;
+    }
+    setupBuffers();
+    is_uploaded_ = true;
+
+    // The data lives in the GL buffers from now on.
+    //
+    std::vector<TerrainRtin::Vertex>().swap(vertices_);
+    std::vector<uint32_t>().swap(indices_);
+}
+
+void TerrainRtin::Release()
+{
+    if (!is_uploaded_)
+    {
+        return;
+    }
+    glDeleteVertexArrays(1, &vao_);
+    glDeleteBuffers(1, &vbo_);
+    glDeleteBuffers(1, &ebo_);
+    vao_ = vbo_ = ebo_ = 0;
+    is_uploaded_ = false;
+}
+
+void TerrainRtin::Draw(Shader &shader)
+{
+    if (!is_uploaded_)
+    {
+        return;
+    }
+
+    shader.Use();
+    shader.SetMat4("model", _world_transform_);
+    shader.SetMat4("unitModel", unit_transform_);
+    glBindVertexArray(vao_);
+    glDrawElements(GL_TRIANGLES, (GLsizei)index_count_, GL_UNSIGNED_INT, (const void *)0);
+    glBindVertexArray(0);
+}
+
+uint32_t TerrainRtin::GetTriangleCount() { return index_count_ / 3; }
+
+uint32_t TerrainRtin::GetVertexCount() { return vertex_count_; }
+
+std::size_t TerrainRtin::GetByteSize()
+{
+    return sizeof(TerrainRtin::Vertex) * vertex_count_ + sizeof(uint32_t) * index_count_;
+}
+
+void TerrainRtin::computeErrors(const std::vector<glm::vec3> &positions)
+{
+    // errors_[m] is the largest error of any triangle whose hypotenuse midpoint is m, or of
+    // any triangle below it. A triangle is split if the error at its midpoint is too large,
+    // and since the error includes all descendants, the split decision for the whole
+    // subtree is made at the top.
+    //
+    // The triangles are visited children first with an explicit stack. Every entry is
+    // (a, b, c) with the right angle at c, the hypotenuse runs from a to b.
+    //
+    struct Entry
+    {
+        uint32_t ax, ay, bx, by, cx, cy;
+        bool children_done;
+    };
+
+    errors_.assign((std::size_t)rtin_size_ * rtin_size_, 0.0f);
+    const uint32_t max = rtin_size_ - 1;
+    std::vector<Entry> stack;
+    stack.push_back({0, 0, max, max, max, 0, false});
+    stack.push_back({max, max, 0, 0, 0, max, false});
+
+    while (!stack.empty())
+    {
+        Entry entry = stack.back();
+        stack.pop_back();
+
+        // Triangles with legs of one cell have no grid point on their hypotenuse.
+        //
+        const uint32_t leg = (uint32_t)(std::abs((int)entry.ax - (int)entry.cx) +
+                                        std::abs((int)entry.ay - (int)entry.cy));
+        if (leg <= 1)
+        {
+            continue;
+        }
+
+        // The children (c, a, m) and (b, c, m) have their own midpoints if the legs of this
+        // triangle run an even number of cells along both axes.
+        //
+        const uint32_t mx = (entry.ax + entry.bx) / 2;
+        const uint32_t my = (entry.ay + entry.by) / 2;
+        const bool has_children = (entry.ax - entry.cx) % 2 == 0 && (entry.ay - entry.cy) % 2 == 0;
+        if (has_children && !entry.children_done)
+        {
+            entry.children_done = true;
+            stack.push_back(entry);
+            stack.push_back({entry.cx, entry.cy, entry.ax, entry.ay, mx, my, false});
+            stack.push_back({entry.bx, entry.by, entry.cx, entry.cy, mx, my, false});
+            continue;
+        }
+
+        float interpolated = 0.5f * (worldHeight(positions, entry.ax, entry.ay) +
+                                     worldHeight(positions, entry.bx, entry.by));
+        float &error = errors_[(std::size_t)my * rtin_size_ + mx];
+        error = std::max(error, std::abs(interpolated - worldHeight(positions, mx, my)));
+        if (has_children)
+        {
+            // The midpoints of the hypotenuses of (c, a, m) and (b, c, m).
+            //
+            std::size_t left =
+                (std::size_t)((entry.ay + entry.cy) / 2) * rtin_size_ + (entry.ax + entry.cx) / 2;
+            std::size_t right =
+                (std::size_t)((entry.by + entry.cy) / 2) * rtin_size_ + (entry.bx + entry.cx) / 2;
+            error = std::max(error, std::max(errors_[left], errors_[right]));
+        }
+    }
+}
+
+void TerrainRtin::buildMesh(const std::vector<glm::vec3> &positions)
+{
+    // Quantize relative to the bounding box so the full 16 bits cover the actual heights.
+    //
+    glm::vec3 min_p(std::numeric_limits<float>::max());
+    glm::vec3 max_p(std::numeric_limits<float>::lowest());
+    for (const glm::vec3 &p : positions)
+    {
+        min_p = glm::min(min_p, p);
+        max_p = glm::max(max_p, p);
+    }
+    position_min_ = min_p;
+    position_extent_ = glm::max(max_p - min_p, glm::vec3(1e-6f));
+    unit_transform_ = glm::translate(glm::mat4(1.0f), position_min_) *
+                      glm::scale(glm::mat4(1.0f), position_extent_);
+
+    vertex_map_.assign((std::size_t)rtin_size_ * rtin_size_, std::numeric_limits<uint32_t>::max());
+    const uint32_t max = rtin_size_ - 1;
+    processTriangle(positions, 0, 0, max, max, max, 0);
+    processTriangle(positions, max, max, 0, 0, 0, max);
+    vertex_count_ = (uint32_t)vertices_.size();
+    index_count_ = (uint32_t)indices_.size();
+}
+
+void TerrainRtin::processTriangle(const std::vector<glm::vec3> &positions,
+                                  const uint32_t _ax,
+                                  const uint32_t _ay,
+                                  const uint32_t _bx,
+                                  const uint32_t _by,
+                                  const uint32_t _cx,
+                                  const uint32_t _cy)
+{
+    const uint32_t mx = (_ax + _bx) / 2;
+    const uint32_t my = (_ay + _by) / 2;
+    const uint32_t leg = (uint32_t)(std::abs((int)_ax - (int)_cx) + std::abs((int)_ay - (int)_cy));
+    if (leg > 1 && errors_[(std::size_t)my * rtin_size_ + mx] > _max_error_)
+    {
+        processTriangle(positions, _cx, _cy, _ax, _ay, mx, my);
+        processTriangle(positions, _bx, _by, _cx, _cy, mx, my);
+        return;
+    }
+
+    // Triangles in the padding collapse to lines or points and are left out. The rest are
+    // wound counter-clockwise seen from above, the side that faces the camera.
+    //
+    const glm::vec3 &a = positions[sourceIndex(_ax, _ay)];
+    const glm::vec3 &b = positions[sourceIndex(_bx, _by)];
+    const glm::vec3 &c = positions[sourceIndex(_cx, _cy)];
+    const float area = (b.z - a.z) * (c.x - a.x) - (b.x - a.x) * (c.z - a.z);
+    if (std::abs(area) <= std::numeric_limits<float>::min())
+    {
+        return;
+    }
+
+    uint32_t ia = vertexIndex(positions, _ax, _ay);
+    uint32_t ib = vertexIndex(positions, _bx, _by);
+    uint32_t ic = vertexIndex(positions, _cx, _cy);
+    if (area < 0.0f)
+    {
+        std::swap(ib, ic);
+    }
+    indices_.push_back(ia);
+    indices_.push_back(ib);
+    indices_.push_back(ic);
+}
+
+uint32_t TerrainRtin::vertexIndex(const std::vector<glm::vec3> &positions,
+                                  const uint32_t _x,
+                                  const uint32_t _y)
+{
+    uint32_t &index = vertex_map_[(std::size_t)_y * rtin_size_ + _x];
+    if (index != std::numeric_limits<uint32_t>::max())
+    {
+        return index;
+    }
+
+    const uint32_t source = sourceIndex(_x, _y);
+    glm::vec3 position =
+        glm::clamp((positions[source] - position_min_) / position_extent_, 0.0f, 1.0f);
+
+    TerrainRtin::Vertex vertex;
+    vertex.position[0] = (uint16_t)std::lround(position.x * 65535.0f);
+    vertex.position[1] = (uint16_t)std::lround(position.y * 65535.0f);
+    vertex.position[2] = (uint16_t)std::lround(position.z * 65535.0f);
+    vertex.position[3] = 0;
+
+    index = (uint32_t)vertices_.size();
+    vertices_.push_back(vertex);
+    return index;
+}
+
+uint32_t TerrainRtin::sourceIndex(const uint32_t _x, const uint32_t _y)
+{
+    // x runs along the grid rows, y across them, the grid point is (i, j) = (y, x).
+    //
+    return std::min(_y, _grid_size_ - 1) * _grid_size_ + std::min(_x, _grid_size_ - 1);
+}
+
+float TerrainRtin::worldHeight(const std::vector<glm::vec3> &positions,
+                               const uint32_t _x,
+                               const uint32_t _y)
+{
+    const glm::vec3 &p = positions[sourceIndex(_x, _y)];
+    return (_world_transform_ * glm::vec4(p, 1.0f)).y;
+}
+
+void TerrainRtin::setupBuffers()
+{
+    glGenVertexArrays(1, &vao_);
+    glGenBuffers(1, &vbo_);
+    glGenBuffers(1, &ebo_);
+
+    glBindVertexArray(vao_);
+
+    glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+    glBufferData(GL_ARRAY_BUFFER,
+                 sizeof(TerrainRtin::Vertex) * vertices_.size(),
+                 vertices_.data(),
+                 GL_STATIC_DRAW);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo_);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                 sizeof(uint32_t) * indices_.size(),
+                 indices_.data(),
+                 GL_STATIC_DRAW);
+
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0,
+                          4,
+                          GL_UNSIGNED_SHORT,
+                          GL_TRUE,
+                          sizeof(TerrainRtin::Vertex),
+                          (const void *)offsetof(TerrainRtin::Vertex, position));
+
+    glBindVertexArray(0);
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "Renderer/Shader.h"
+
+// Adaptive terrain mesh, a right-triangulated irregular network (RTIN).
+//
+// The grid is covered by two right triangles that are split recursively at the midpoint of
+// their hypotenuse, down to single grid cells. A triangle is only split where its hypotenuse
+// midpoint, or anything below it, is farther than _max_error from the interpolated height, so
+// flat areas end up with a few large triangles and ridges keep the full resolution. Because
+// neighbours always split the shared hypotenuse together, the mesh has no T-junctions.
+//
+// Every grid point is stored at most once. The faceted look does not need per-triangle
+// normals or colors, lowPolyTerrainRtin.frag derives the flat normal from the screen space
+// derivatives of the fragment position and picks the color from the height and slope.
+//
+// Construction only builds the vertex and index data on the CPU, Upload creates the GL
+// buffers and has to be called on the thread owning the GL context.
+//
+class TerrainRtin
+{
+public:
+    // 8 bytes. position is normalized to the bounding box of the terrain (see
+    // unit_transform_), the fourth component is unused.
+    //
+    struct Vertex
+    {
+        uint16_t position[4];
+    };
+
+    // _max_error is the largest allowed vertical distance between the mesh and the grid, in
+    // world units.
+    //
+    TerrainRtin(const std::vector<glm::vec3> &_positions,
+                const uint32_t _grid_size,
+                const glm::mat4 &_world_transform,
+                const float _max_error = 0.5f);
+
+    void Upload();
+    void Release();
+    void Draw(Shader &shader);
+
+    uint32_t GetTriangleCount();
+    uint32_t GetVertexCount();
+    std::size_t GetByteSize();
+
+private:
+    const uint32_t _grid_size_;
+    const glm::mat4 _world_transform_;
+    const float _max_error_;
+
+    // The RTIN works on a square of 2^k + 1 points, the grid is padded up to it by clamping.
+    //
+    uint32_t rtin_size_;
+    std::vector<float> errors_;
+    std::vector<uint32_t> vertex_map_;
+
+    glm::mat4 unit_transform_;
+    glm::vec3 position_min_, position_extent_;
+    std::vector<TerrainRtin::Vertex> vertices_;
+    std::vector<uint32_t> indices_;
+    uint32_t vertex_count_, index_count_;
+
+    bool is_uploaded_;
+    uint32_t vao_, vbo_, ebo_;
+
+    void computeErrors(const std::vector<glm::vec3> &positions);
+    void buildMesh(const std::vector<glm::vec3> &positions);
+    void processTriangle(const std::vector<glm::vec3> &positions,
+                         const uint32_t _ax,
+                         const uint32_t _ay,
+                         const uint32_t _bx,
+                         const uint32_t _by,
+                         const uint32_t _cx,
+                         const uint32_t _cy);
+    uint32_t vertexIndex(const std::vector<glm::vec3> &positions,
+                         const uint32_t _x,
+                         const uint32_t _y);
+    uint32_t sourceIndex(const uint32_t _x, const uint32_t _y);
+    float worldHeight(const std::vector<glm::vec3> &positions,
+                      const uint32_t _x,
+                      const uint32_t _y);
+    void setupBuffers();
+};
@@ -0,0 +1,489 @@
+#include "Terrain/TerrainStreamer.h"
+
+// Height map cells per chunk side, a power of two so the chunk quadtree needs no padding.
+//
+const uint32_t TerrainStreamer::_CHUNK_CELLS_ = 64;
+
+// Uploading a chunk is cheap, but bounding it keeps a burst of finished chunks (e.g. after a
+// teleport) from stalling a single frame.
+//
+const uint32_t TerrainStreamer::_UPLOADS_PER_FRAME_ = 2;
+
+// The instance matrices are uploaded every frame, so only the chunks around the player that can
+// be within the far plane contribute vegetation.
+//
+const int TerrainStreamer::_VEGETATION_RADIUS_ = 1;
+
+TerrainStreamer::TerrainStreamer(const NoiseGenerator::Settings &_settings,
+                                 const uint32_t _grid_size,
+                                 const float _height_scale,
+                                 const int _ring_radius,
+                                 const std::size_t _budget_bytes,
+                                 const TERRAINRENDERenum _render_mode,
+                                 const std::shared_ptr<DemSource> _dem)
+    : _settings_(_settings), _grid_size_(_grid_size), _height_scale_(_height_scale),
+      _ring_radius_(_ring_radius), _budget_bytes_(_budget_bytes), _render_mode_(_render_mode),
+      _dem_(_dem), resident_bytes_(0),
+      model_mats_dirty_(false), center_x_(0), center_z_(0), is_stopping_(false)
+{
+    for (int i = 0; i < 7; i++)
+    {
+        model_mats_.push_back(std::make_shared<std::vector<glm::mat4>>());
+    }
+
+    // All chunks share the LOD ranges so that they match at the chunk borders. Same rule as in
+    // TerrainLod::buildRanges, with the largest possible height range.
+    //
+    float node_size = 2.0f * 2.0f * 16.0f;
+    base_range_ = 1.1f * std::sqrt(2.0f * node_size * node_size + _height_scale_ * _height_scale_);
+
+    uint32_t worker_count = std::min(4u, std::max(1u, Parallel::GetThreadCount() - 1));
+    for (uint32_t i = 0; i < worker_count; i++)
+    {
+        workers_.emplace_back(&TerrainStreamer::workerLoop, this);
+    }
+}
+
+TerrainStreamer::~TerrainStreamer()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        is_stopping_ = true;
+    }
+    job_ready_.notify_all();
+    for (std::size_t i = 0; i < workers_.size(); i++)
+    {
+        workers_.at(i).join();
+    }
+
+    for (auto &chunk : chunks_)
+    {
+        chunk.second->lod->Release();
+    }
+}
+
+void TerrainStreamer::Preload(const glm::vec3 &_player_pos)
+{
+    // Blocks until the chunks next to the player are resident, for the first frame.
+    //
+    Update(_player_pos);
+    int center_x, center_z;
+    chunkCoords(_player_pos, center_x, center_z);
+    for (int x = center_x - 1; x <= center_x + 1; x++)
+    {
+        for (int z = center_z - 1; z <= center_z + 1; z++)
+        {
+            while (chunks_.find(chunkKey(x, z)) == chunks_.end())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                uploadFinished();
+            }
+        }
+    }
+    rebuildModelMats();
+}
+
+void TerrainStreamer::Update(const glm::vec3 &_player_pos)
+{
+    int center_x, center_z;
+    chunkCoords(_player_pos, center_x, center_z);
+    if (center_x != center_x_ || center_z != center_z_)
+    {
+        center_x_ = center_x;
+        center_z_ = center_z;
+        model_mats_dirty_ = true;
+    }
+
+    uploadFinished();
+
+    // Queue the missing chunks of the ring nearest first and drop queued chunks the player
+    // has left behind. Chunks in the ring count as used this frame.
+    //
+    std::vector<std::pair<int, uint64_t>> missing;
+    for (int x = center_x - _ring_radius_; x <= center_x + _ring_radius_; x++)
+    {
+        for (int z = center_z - _ring_radius_; z <= center_z + _ring_radius_; z++)
+        {
+            uint64_t key = chunkKey(x, z);
+            auto chunk = chunks_.find(key);
+            if (chunk != chunks_.end())
+            {
+                lru_.splice(lru_.begin(), lru_, chunk->second->lru);
+            }
+            else if (pending_.find(key) == pending_.end())
+            {
+                int dx = x - center_x;
+                int dz = z - center_z;
+                missing.push_back(std::make_pair(dx * dx + dz * dz, key));
+            }
+        }
+    }
+
+    if (!missing.empty())
+    {
+        std::sort(missing.begin(), missing.end());
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto it = jobs_.begin(); it != jobs_.end();)
+            {
+                int x = (int)(int32_t)(*it >> 32);
+                int z = (int)(int32_t)(*it & 0xffffffffu);
+                if (std::abs(x - center_x) > _ring_radius_ ||
+                    std::abs(z - center_z) > _ring_radius_)
+                {
+                    pending_.erase(*it);
+                    it = jobs_.erase(it);
+                }
+                else
+                {
+                    it++;
+                }
+            }
+            for (std::size_t i = 0; i < missing.size(); i++)
+            {
+                jobs_.push_front(missing.at(missing.size() - 1 - i).second);
+                pending_.insert(missing.at(missing.size() - 1 - i).second);
+            }
+        }
+        job_ready_.notify_all();
+    }
+
+    evict(center_x, center_z);
+
+    if (model_mats_dirty_)
+    {
+        rebuildModelMats();
+    }
+}
+
+void TerrainStreamer::Draw(Shader &shader, const Camera &camera)
+{
+    for (auto &chunk : chunks_)
+    {
+        chunk.second->lod->Draw(shader, camera);
+    }
+}
+
+float TerrainStreamer::GetHeight(const glm::vec3 &_position)
+{
+    // Interpolated on the triangle below the position, like Heightfield::Sample. Samples of
+    // chunks that are not resident are read from the source of the chunks, the elevation data
+    // at the offset generateChunk reads it with or else the noise.
+    //
+    auto sample = [&](int64_t i, int64_t j) {
+        int x = (int)std::floor((double)i / _CHUNK_CELLS_);
+        int z = (int)std::floor((double)j / _CHUNK_CELLS_);
+        auto chunk = chunks_.find(chunkKey(x, z));
+        if (chunk != chunks_.end())
+        {
+            int64_t local_i = i - (int64_t)x * _CHUNK_CELLS_;
+            int64_t local_j = j - (int64_t)z * _CHUNK_CELLS_;
+            return chunk->second->heights[local_i * (_CHUNK_CELLS_ + 1) + local_j];
+        }
+        if (_dem_)
+        {
+            float height;
+            _dem_->ReadTile(i + _dem_->GetRows() / 2, j + _dem_->GetCols() / 2, 1, 1, &height);
+            return height;
+        }
+        return NoiseGenerator::PerlinNoise2DAt(_settings_, (double)j, (double)i);
+    };
+
+    double gx = (double)_position.x / 2.0;
+    double gz = (double)_position.z / 2.0;
+    int64_t i = (int64_t)std::floor(gx);
+    int64_t j = (int64_t)std::floor(gz);
+    float tx = (float)(gx - (double)i);
+    float tz = (float)(gz - (double)j);
+
+    float height = Heightfield::InterpolateTriangle(
+        sample(i, j), sample(i, j + 1), sample(i + 1, j), sample(i + 1, j + 1), tx, tz);
+    return height * _height_scale_;
+}
+
+uint32_t TerrainStreamer::Collect(AABB range)
+{
+    int x_min, z_min, x_max, z_max;
+    chunkCoords(glm::vec3(range.XMin(), 0.0f, range.ZMin()), x_min, z_min);
+    chunkCoords(glm::vec3(range.XMax(), 0.0f, range.ZMax()), x_max, z_max);
+
+    uint32_t count = 0;
+    for (int x = x_min; x <= x_max; x++)
+    {
+        for (int z = z_min; z <= z_max; z++)
+        {
+            uint64_t key = chunkKey(x, z);
+            auto chunk = chunks_.find(key);
+            if (chunk == chunks_.end())
+            {
+                continue;
+            }
+
+            // The set of a chunk is only created by its first pickup, so walking around does
+            // not leave an empty set behind for every chunk the player passes.
+            //
+            std::vector<glm::mat4> &hazelnuts = chunk->second->model_mats[6];
+            auto collected = collected_.find(key);
+            for (uint32_t i = 0; i < (uint32_t)hazelnuts.size(); i++)
+            {
+                if (!range.Contains(glm::vec3(hazelnuts.at(i)[3])))
+                {
+                    continue;
+                }
+                if (collected == collected_.end())
+                {
+                    collected = collected_.emplace(key, std::unordered_set<uint32_t>()).first;
+                }
+                if (collected->second.insert(i).second)
+                {
+                    count++;
+                }
+            }
+        }
+    }
+
+    if (count > 0)
+    {
+        rebuildModelMats();
+    }
+    return count;
+}
+
+std::vector<std::shared_ptr<std::vector<glm::mat4>>> &TerrainStreamer::GetModelMats()
+{
+    return model_mats_;
+}
+
+std::size_t TerrainStreamer::GetResidentBytes() { return resident_bytes_; }
+
+std::size_t TerrainStreamer::GetResidentCount() { return chunks_.size(); }
+
+std::size_t TerrainStreamer::GetPendingCount() { return pending_.size(); }
+
+void TerrainStreamer::workerLoop()
+{
+    // The workers already generate one chunk each on their own core, so the noise of a chunk
+    // is not split any further.
+    //
+    Parallel::SetSerial(true);
+    while (true)
+    {
+        uint64_t key;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            job_ready_.wait(lock, [this]() { return is_stopping_ || !jobs_.empty(); });
+            if (is_stopping_)
+            {
+                return;
+            }
+            key = jobs_.front();
+            jobs_.pop_front();
+        }
+
+        std::shared_ptr<Chunk> chunk =
+            generateChunk((int)(int32_t)(key >> 32), (int)(int32_t)(key & 0xffffffffu));
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        finished_.push_back(chunk);
+    }
+}
+
+std::shared_ptr<TerrainStreamer::Chunk> TerrainStreamer::generateChunk(const int _x, const int _z)
+{
+    std::shared_ptr<Chunk> chunk = std::make_shared<Chunk>();
+    chunk->x = _x;
+    chunk->z = _z;
+
+    // Rows of the tile run along world x and columns along world z, like the static grid.
+    //
+    const uint32_t samples = _CHUNK_CELLS_ + 1;
+    chunk->heights.resize((std::size_t)samples * samples);
+    if (_dem_)
+    {
+        _dem_->ReadTile((int64_t)_x * _CHUNK_CELLS_ + _dem_->GetRows() / 2,
+                        (int64_t)_z * _CHUNK_CELLS_ + _dem_->GetCols() / 2,
+                        samples,
+                        samples,
+                        chunk->heights.data());
+    }
+    else
+    {
+        NoiseGenerator::PerlinNoise2DTile(_settings_,
+                                          _z * (int)_CHUNK_CELLS_,
+                                          _x * (int)_CHUNK_CELLS_,
+                                          (int)samples,
+                                          (int)samples,
+                                          chunk->heights.data());
+    }
+
+    std::vector<glm::vec3> positions(chunk->heights.size());
+    for (uint32_t i = 0; i < samples; i++)
+    {
+        for (uint32_t j = 0; j < samples; j++)
+        {
+            positions[i * samples + j] = glm::vec3((float)i / (float)_grid_size_,
+                                                   chunk->heights[i * samples + j],
+                                                   (float)j / (float)_grid_size_);
+        }
+    }
+    glm::mat4 world_transform = glm::translate(
+        glm::mat4(1.0f),
+        glm::vec3((float)_x * chunkWorldSize(), 0.0f, (float)_z * chunkWorldSize()));
+    world_transform = glm::scale(
+        world_transform,
+        glm::vec3((float)(_grid_size_ * 2), _height_scale_, (float)(_grid_size_ * 2)));
+    chunk->lod = std::make_shared<TerrainLod>(
+        positions, samples, world_transform, base_range_, _render_mode_);
+
+    generateVegetation(*chunk);
+
+    chunk->byte_size = sizeof(float) * chunk->heights.size() + chunk->lod->GetByteSize();
+    for (int i = 0; i < 7; i++)
+    {
+        chunk->byte_size += sizeof(glm::mat4) * chunk->model_mats[i].size();
+    }
+    return chunk;
+}
+
+void TerrainStreamer::generateVegetation(Chunk &chunk)
+{
+    // Same density and mix as TerrainGenerator and Terrain use for the default grid: 40% trees
+    // (1/5 tree 1, 2/5 each tree 2 and 3), 15% bushes, 10% rocks, 32% grass buds and 3%
+    // hazelnuts. The border samples belong to the neighbouring chunks. The plants stay on grid
+    // points, a Poisson-disc scatter would have to see the plants of the neighbouring chunks,
+    // which may not be generated yet.
+    //
+    std::mt19937 rnd_eng(NoiseGenerator::Hash(_settings_.seed ^ 0x9e3779b9u, chunk.x, chunk.z));
+    std::vector<uint32_t> cells(_CHUNK_CELLS_ * _CHUNK_CELLS_);
+    for (uint32_t i = 0; i < (uint32_t)cells.size(); i++)
+    {
+        cells[i] = i;
+    }
+    std::vector<uint32_t> sample;
+    std::sample(cells.begin(),
+                cells.end(),
+                std::back_inserter(sample),
+                (std::size_t)_CHUNK_CELLS_ * _CHUNK_CELLS_ * 38 / 128,
+                rnd_eng);
+    std::shuffle(sample.begin(), sample.end(), rnd_eng);
+
+    const float bounds[7] = {0.08f, 0.24f, 0.4f, 0.55f, 0.65f, 0.97f, 1.0f};
+    const uint32_t samples = _CHUNK_CELLS_ + 1;
+    const float cell_size = 2.0f;
+    std::size_t first = 0;
+    for (int type = 0; type < 7; type++)
+    {
+        std::size_t last = (std::size_t)(sample.size() * bounds[type]);
+        for (std::size_t k = first; k < last; k++)
+        {
+            uint32_t i = sample.at(k) / _CHUNK_CELLS_;
+            uint32_t j = sample.at(k) % _CHUNK_CELLS_;
+            glm::vec3 position((float)chunk.x * chunkWorldSize() + (float)i * cell_size,
+                               chunk.heights[i * samples + j] * _height_scale_,
+                               (float)chunk.z * chunkWorldSize() + (float)j * cell_size);
+            chunk.model_mats[type].push_back(glm::translate(glm::mat4(1.0f), position));
+        }
+        first = last;
+    }
+}
+
+void TerrainStreamer::uploadFinished()
+{
+    std::vector<std::shared_ptr<Chunk>> finished;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::size_t count = std::min<std::size_t>(_UPLOADS_PER_FRAME_, finished_.size());
+        finished.assign(finished_.begin(), finished_.begin() + count);
+        finished_.erase(finished_.begin(), finished_.begin() + count);
+    }
+
+    for (std::shared_ptr<Chunk> &chunk : finished)
+    {
+        uint64_t key = chunkKey(chunk->x, chunk->z);
+        pending_.erase(key);
+        chunk->lod->Upload();
+        lru_.push_front(key);
+        chunk->lru = lru_.begin();
+        resident_bytes_ += chunk->byte_size;
+        chunks_[key] = chunk;
+        if (std::abs(chunk->x - center_x_) <= _VEGETATION_RADIUS_ &&
+            std::abs(chunk->z - center_z_) <= _VEGETATION_RADIUS_)
+        {
+            model_mats_dirty_ = true;
+        }
+    }
+}
+
+void TerrainStreamer::evict(const int _center_x, const int _center_z)
+{
+    // Least recently used first. The ring itself is never evicted, so the budget is a soft
+    // limit if it is smaller than the ring.
+    //
+    auto it = lru_.end();
+    while (resident_bytes_ > _budget_bytes_ && it != lru_.begin())
+    {
+        it--;
+        std::shared_ptr<Chunk> chunk = chunks_.at(*it);
+        if (std::abs(chunk->x - _center_x) <= _ring_radius_ &&
+            std::abs(chunk->z - _center_z) <= _ring_radius_)
+        {
+            continue;
+        }
+
+        chunk->lod->Release();
+        resident_bytes_ -= chunk->byte_size;
+        chunks_.erase(*it);
+        it = lru_.erase(it);
+    }
+}
+
+void TerrainStreamer::rebuildModelMats()
+{
+    for (int type = 0; type < 7; type++)
+    {
+        model_mats_.at(type)->clear();
+    }
+    for (int x = center_x_ - _VEGETATION_RADIUS_; x <= center_x_ + _VEGETATION_RADIUS_; x++)
+    {
+        for (int z = center_z_ - _VEGETATION_RADIUS_; z <= center_z_ + _VEGETATION_RADIUS_; z++)
+        {
+            uint64_t key = chunkKey(x, z);
+            auto chunk = chunks_.find(key);
+            if (chunk == chunks_.end())
+            {
+                continue;
+            }
+            for (int type = 0; type < 6; type++)
+            {
+                model_mats_.at(type)->insert(model_mats_.at(type)->end(),
+                                             chunk->second->model_mats[type].begin(),
+                                             chunk->second->model_mats[type].end());
+            }
+
+            auto collected = collected_.find(key);
+            std::vector<glm::mat4> &hazelnuts = chunk->second->model_mats[6];
+            for (uint32_t i = 0; i < (uint32_t)hazelnuts.size(); i++)
+            {
+                if (collected == collected_.end() ||
+                    collected->second.find(i) == collected->second.end())
+                {
+                    model_mats_.at(6)->push_back(hazelnuts.at(i));
+                }
+            }
+        }
+    }
+    model_mats_dirty_ = false;
+}
+
+float TerrainStreamer::chunkWorldSize() { return (float)_CHUNK_CELLS_ * 2.0f; }
+
+uint64_t TerrainStreamer::chunkKey(const int _x, const int _z)
+{
+    return ((uint64_t)(uint32_t)_x << 32) | (uint64_t)(uint32_t)_z;
+}
+
+void TerrainStreamer::chunkCoords(const glm::vec3 &_position, int &x, int &z)
+{
+    x = (int)std::floor(_position.x / chunkWorldSize());
+    z = (int)std::floor(_position.z / chunkWorldSize());
+}
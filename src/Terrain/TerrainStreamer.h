@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "Application/Parallel.h"
+#include "Renderer/Camera.h"
+#include "Renderer/Shader.h"
+#include "Terrain/DemSource.h"
+#include "Terrain/Heightfield.h"
+#include "Terrain/NoiseGenerator.h"
+#include "Terrain/TerrainLod.h"
+#include "Types/AABB.h"
+#include "Types/ETerrain.h"
+
+// Unbounded terrain made of square chunks that are generated around the player.
+//
+// A chunk is fully determined by the world seed and its chunk coordinates: its heights are a
+// tile of the same noise field, so neighbouring chunks share their border samples, and its
+// vegetation is drawn from a generator seeded with the chunk coordinates. An evicted chunk
+// therefore comes back exactly the same.
+//
+// Worker threads generate the height data, LOD mesh and vegetation of the chunks in a ring
+// around the player, nearest first. Update, called once per frame on the GL thread, uploads
+// at most _UPLOADS_PER_FRAME_ finished chunks and evicts the least recently used chunks
+// outside of the ring once the resident chunks exceed the memory budget.
+//
+// Chunks keep the proportions of Terrain(_grid_size), one height sample every 2 world units.
+//
+// Given a _dem, the chunk heights are tiles of the elevation data instead of the noise, read
+// by the workers as the chunks are generated. The center of the data is at the world origin,
+// beyond its edges the edge samples continue. The vegetation is still drawn from the seed.
+//
+class TerrainStreamer
+{
+public:
+    TerrainStreamer(const NoiseGenerator::Settings &_settings,
+                    const uint32_t _grid_size = 128,
+                    const float _height_scale = 10.0f,
+                    const int _ring_radius = 2,
+                    const std::size_t _budget_bytes = 48 * 1024 * 1024,
+                    const TERRAINRENDERenum _render_mode = TERRAINRENDERenum::VERTEX_BUFFER,
+                    const std::shared_ptr<DemSource> _dem = nullptr);
+    TerrainStreamer(const TerrainStreamer &) = delete;
+    TerrainStreamer &operator=(const TerrainStreamer &) = delete;
+    ~TerrainStreamer();
+
+    void Preload(const glm::vec3 &_player_pos);
+    void Update(const glm::vec3 &_player_pos);
+    void Draw(Shader &shader, const Camera &camera);
+
+    float GetHeight(const glm::vec3 &_position);
+    uint32_t Collect(AABB range);
+
+    // Instance matrices of the resident chunks within _VEGETATION_RADIUS_ of the player, in
+    // the order tree 1, tree 2, tree 3, bush, rock, grass, hazelnut. The vectors are refilled
+    // in place when the player changes chunks or a chunk next to the player arrives.
+    //
+    std::vector<std::shared_ptr<std::vector<glm::mat4>>> &GetModelMats();
+
+    std::size_t GetResidentBytes();
+    std::size_t GetResidentCount();
+    std::size_t GetPendingCount();
+
+private:
+    struct Chunk
+    {
+        int x, z;
+        std::vector<float> heights;
+        std::shared_ptr<TerrainLod> lod;
+        std::vector<glm::mat4> model_mats[7];
+        std::size_t byte_size;
+        std::list<uint64_t>::iterator lru;
+    };
+
+    const NoiseGenerator::Settings _settings_;
+    const uint32_t _grid_size_;
+    const float _height_scale_;
+    const int _ring_radius_;
+    const std::size_t _budget_bytes_;
+    const TERRAINRENDERenum _render_mode_;
+    const std::shared_ptr<DemSource> _dem_;
+    float base_range_;
+
+    std::unordered_map<uint64_t, std::shared_ptr<Chunk>> chunks_;
+    std::list<uint64_t> lru_;
+    std::size_t resident_bytes_;
+    std::unordered_set<uint64_t> pending_;
+    std::unordered_map<uint64_t, std::unordered_set<uint32_t>> collected_;
+    std::vector<std::shared_ptr<std::vector<glm::mat4>>> model_mats_;
+    bool model_mats_dirty_;
+    int center_x_, center_z_;
+
+    std::mutex mutex_;
+    std::condition_variable job_ready_;
+    std::deque<uint64_t> jobs_;
+    std::vector<std::shared_ptr<Chunk>> finished_;
+    std::vector<std::thread> workers_;
+    bool is_stopping_;
+
+    static const uint32_t _CHUNK_CELLS_;
+    static const uint32_t _UPLOADS_PER_FRAME_;
+    static const int _VEGETATION_RADIUS_;
+
+    void workerLoop();
+    std::shared_ptr<Chunk> generateChunk(const int _x, const int _z);
+    void generateVegetation(Chunk &chunk);
+    void uploadFinished();
+    void evict(const int _center_x, const int _center_z);
+    void rebuildModelMats();
+
+    float chunkWorldSize();
+    uint64_t chunkKey(const int _x, const int _z);
+    void chunkCoords(const glm::vec3 &_position, int &x, int &z);
+};
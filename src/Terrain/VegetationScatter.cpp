@@ -0,0 +1,206 @@
+#include "Terrain/VegetationScatter.h"
+
+// Side of a tile in grid units, rounded down to whole hash cells.
+//
+const float VegetationScatter::_TILE_SIZE_ = 16.0f;
+
+// Candidates drawn per wanted point before a tile gives up on the rest, only dense layers
+// with large distances run out of them.
+//
+const uint32_t VegetationScatter::_ATTEMPTS_PER_POINT_ = 8;
+
+VegetationScatter::VegetationScatter(const uint32_t _rows,
+                                     const uint32_t _cols,
+                                     const std::vector<VegetationScatter::Layer> &_layers,
+                                     const uint32_t _seed)
+    : _rows_(_rows), _cols_(_cols), _layers_(_layers), _seed_(_seed)
+{
+    setupGrid();
+    for (uint32_t layer = 0; layer < (uint32_t)_layers_.size(); layer++)
+    {
+        scatterLayer(layer);
+    }
+    collectPoints();
+
+    // Only needed while scattering.
+    //
+    std::vector<int32_t>().swap(cell_heads_);
+    std::vector<std::vector<VegetationScatter::Point>>().swap(tile_points_);
+}
+
+std::vector<glm::vec2> &VegetationScatter::GetPoints(const uint32_t _layer)
+{
+    return layer_points_.at(_layer);
+}
+
+void VegetationScatter::setupGrid()
+{
+    // No two points interact farther apart than the largest minimum distance.
+    //
+    cell_size_ = 0.25f;
+    for (const VegetationScatter::Layer &layer : _layers_)
+    {
+        cell_size_ = std::max(cell_size_, layer.min_distance);
+    }
+
+    const float extent_x = (float)std::max(_rows_, 1u) - 1.0f;
+    const float extent_y = (float)std::max(_cols_, 1u) - 1.0f;
+    cells_x_ = std::max(1u, (uint32_t)std::ceil(extent_x / cell_size_));
+    cells_y_ = std::max(1u, (uint32_t)std::ceil(extent_y / cell_size_));
+    cells_per_tile_ = std::max(1u, (uint32_t)(_TILE_SIZE_ / cell_size_));
+    tiles_x_ = (cells_x_ + cells_per_tile_ - 1) / cells_per_tile_;
+    tiles_y_ = (cells_y_ + cells_per_tile_ - 1) / cells_per_tile_;
+
+    cell_heads_.assign((std::size_t)cells_x_ * cells_y_, -1);
+    tile_points_.assign((std::size_t)tiles_x_ * tiles_y_, std::vector<VegetationScatter::Point>());
+    layer_points_.assign(_layers_.size(), std::vector<glm::vec2>());
+}
+
+void VegetationScatter::scatterLayer(const uint32_t _layer)
+{
+    std::vector<glm::uvec2> tiles;
+    tiles.reserve(((std::size_t)tiles_x_ / 2 + 1) * (tiles_y_ / 2 + 1));
+    for (uint32_t pass = 0; pass < 4; pass++)
+    {
+        tiles.clear();
+        for (uint32_t tx = pass >> 1; tx < tiles_x_; tx += 2)
+        {
+            for (uint32_t ty = pass & 1; ty < tiles_y_; ty += 2)
+            {
+                tiles.push_back(glm::uvec2(tx, ty));
+            }
+        }
+        Parallel::For(0, (uint32_t)tiles.size(), 4, [&](uint32_t tile_begin, uint32_t tile_end) {
+            for (uint32_t t = tile_begin; t < tile_end; t++)
+            {
+                scatterTile(_layer, tiles[t].x, tiles[t].y);
+            }
+        });
+    }
+}
+
+void VegetationScatter::scatterTile(const uint32_t _layer,
+                                    const uint32_t _tile_x,
+                                    const uint32_t _tile_y)
+{
+    const float extent_x = (float)std::max(_rows_, 1u) - 1.0f;
+    const float extent_y = (float)std::max(_cols_, 1u) - 1.0f;
+    const float tile_size = cell_size_ * (float)cells_per_tile_;
+    const glm::vec2 lo((float)_tile_x * tile_size, (float)_tile_y * tile_size);
+    const glm::vec2 hi(std::min(lo.x + tile_size, extent_x), std::min(lo.y + tile_size, extent_y));
+    if (hi.x <= lo.x || hi.y <= lo.y)
+    {
+        return;
+    }
+
+    // The fraction of a point left over by the tile area is placed with that probability, so
+    // the expected count matches the density.
+    //
+    std::mt19937 rnd_eng(
+        NoiseGenerator::Hash(_seed_ + _layer * 0x9e3779b9u, (int)_tile_x, (int)_tile_y));
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    const float expected = _layers_[_layer].density * (hi.x - lo.x) * (hi.y - lo.y);
+    uint32_t wanted = (uint32_t)expected;
+    if (unit(rnd_eng) < expected - (float)wanted)
+    {
+        wanted++;
+    }
+
+    uint32_t placed = 0;
+    const uint32_t attempts = wanted * _ATTEMPTS_PER_POINT_;
+    for (uint32_t attempt = 0; attempt < attempts && placed < wanted; attempt++)
+    {
+        // Drawn one after the other, the order of constructor arguments is unspecified.
+        //
+        const float u = unit(rnd_eng);
+        const float v = unit(rnd_eng);
+        glm::vec2 position(lo.x + u * (hi.x - lo.x), lo.y + v * (hi.y - lo.y));
+        position = glm::min(position, hi);
+        if (isFree(position, _layer))
+        {
+            insert(position, _layer, _tile_x, _tile_y);
+            placed++;
+        }
+    }
+}
+
+bool VegetationScatter::isFree(const glm::vec2 &_position, const uint32_t _layer)
+{
+    const uint32_t cell = cellIndex(_position);
+    const int cx = (int)(cell / cells_y_);
+    const int cy = (int)(cell % cells_y_);
+    for (int x = std::max(cx - 1, 0); x <= std::min(cx + 1, (int)cells_x_ - 1); x++)
+    {
+        for (int y = std::max(cy - 1, 0); y <= std::min(cy + 1, (int)cells_y_ - 1); y++)
+        {
+            const std::vector<VegetationScatter::Point> &points =
+                tile_points_[(x / cells_per_tile_) * tiles_y_ + y / cells_per_tile_];
+            for (int32_t p = cell_heads_[(std::size_t)x * cells_y_ + y]; p >= 0; p = points[p].next)
+            {
+                const VegetationScatter::Point &point = points[p];
+                const float distance =
+                    0.5f * (_layers_[_layer].min_distance + _layers_[point.layer].min_distance);
+                const glm::vec2 d = point.position - _position;
+                if (glm::dot(d, d) < distance * distance)
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+void VegetationScatter::insert(const glm::vec2 &_position,
+                               const uint32_t _layer,
+                               const uint32_t _tile_x,
+                               const uint32_t _tile_y)
+{
+    // Only the cells of the tile may change while the other tiles of the pass run. A point on
+    // the far edge of the tile, which rounding can produce, goes into the last cell of the
+    // tile, less than a cell from where it belongs, so the 3 x 3 search still finds it.
+    //
+    const uint32_t cell = cellIndex(_position);
+    const uint32_t cx = std::min(cell / cells_y_, (_tile_x + 1) * cells_per_tile_ - 1);
+    const uint32_t cy = std::min(cell % cells_y_, (_tile_y + 1) * cells_per_tile_ - 1);
+    std::vector<VegetationScatter::Point> &points =
+        tile_points_[(std::size_t)_tile_x * tiles_y_ + _tile_y];
+
+    VegetationScatter::Point point;
+    point.position = _position;
+    point.layer = _layer;
+    point.next = cell_heads_[(std::size_t)cx * cells_y_ + cy];
+    cell_heads_[(std::size_t)cx * cells_y_ + cy] = (int32_t)points.size();
+    points.push_back(point);
+}
+
+void VegetationScatter::collectPoints()
+{
+    std::vector<std::size_t> counts(_layers_.size(), 0);
+    for (const std::vector<VegetationScatter::Point> &points : tile_points_)
+    {
+        for (const VegetationScatter::Point &point : points)
+        {
+            counts[point.layer]++;
+        }
+    }
+    for (std::size_t layer = 0; layer < _layers_.size(); layer++)
+    {
+        layer_points_[layer].reserve(counts[layer]);
+    }
+
+    for (const std::vector<VegetationScatter::Point> &points : tile_points_)
+    {
+        for (const VegetationScatter::Point &point : points)
+        {
+            layer_points_[point.layer].push_back(point.position);
+        }
+    }
+}
+
+uint32_t VegetationScatter::cellIndex(const glm::vec2 &_position)
+{
+    const uint32_t cx = std::min((uint32_t)(_position.x / cell_size_), cells_x_ - 1);
+    const uint32_t cy = std::min((uint32_t)(_position.y / cell_size_), cells_y_ - 1);
+    return cx * cells_y_ + cy;
+}
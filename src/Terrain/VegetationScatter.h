@@ -0,0 +1,88 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Application/Parallel.h"
+#include "Terrain/NoiseGenerator.h"
+
+// Blue noise (Poisson-disc) scatter of several layers of points over a grid.
+//
+// The grid coordinates span [0, _rows - 1] x [0, _cols - 1]. Every layer has a density in
+// points per grid cell and a minimum distance. Two points of layers a and b are at least
+// (min_distance_a + min_distance_b) / 2 apart, so trees, rocks and hazelnuts no longer land on
+// top of each other, while grass may still grow closer to them than to another tree.
+//
+// The layers are thrown one after the other, the first layer is placed most freely. The
+// points live in a uniform hash grid with cells as wide as the largest distance, so a
+// candidate only has to be tested against the 3 x 3 cells around it. The cells are grouped
+// into tiles, every tile draws its candidates from its own generator seeded with _seed and
+// the tile coordinates. The tiles are thrown in four passes of every second tile in both
+// directions, so the tiles of a pass are at least a tile apart, never see each other's
+// points and run on all cores. The result does not depend on the thread count and the work
+// is linear in the number of points.
+//
+class VegetationScatter
+{
+public:
+    struct Layer
+    {
+        float density;
+        float min_distance;
+    };
+
+    VegetationScatter(const uint32_t _rows,
+                      const uint32_t _cols,
+                      const std::vector<VegetationScatter::Layer> &_layers,
+                      const uint32_t _seed);
+
+    // The points of a layer as (i, j) grid coordinates, tile by tile.
+    //
+    std::vector<glm::vec2> &GetPoints(const uint32_t _layer);
+
+private:
+    struct Point
+    {
+        glm::vec2 position;
+        uint32_t layer;
+
+        // Next point in the same hash cell, an index into the points of the tile, or -1.
+        //
+        int32_t next;
+    };
+
+    const uint32_t _rows_, _cols_;
+    const std::vector<VegetationScatter::Layer> _layers_;
+    const uint32_t _seed_;
+
+    float cell_size_;
+    uint32_t cells_x_, cells_y_;
+    uint32_t cells_per_tile_;
+    uint32_t tiles_x_, tiles_y_;
+
+    // First point of every hash cell, an index into the points of the tile the cell lies in.
+    //
+    std::vector<int32_t> cell_heads_;
+    std::vector<std::vector<VegetationScatter::Point>> tile_points_;
+    std::vector<std::vector<glm::vec2>> layer_points_;
+
+    static const float _TILE_SIZE_;
+    static const uint32_t _ATTEMPTS_PER_POINT_;
+
+    void setupGrid();
+    void scatterLayer(const uint32_t _layer);
+    void scatterTile(const uint32_t _layer, const uint32_t _tile_x, const uint32_t _tile_y);
+    bool isFree(const glm::vec2 &_position, const uint32_t _layer);
+    void insert(const glm::vec2 &_position,
+                const uint32_t _layer,
+                const uint32_t _tile_x,
+                const uint32_t _tile_y);
+    void collectPoints();
+
+    uint32_t cellIndex(const glm::vec2 &_position);
+};
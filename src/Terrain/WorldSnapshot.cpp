@@ -0,0 +1,166 @@
+#include "Terrain/WorldSnapshot.h"
+
+// Relative to the working directory, like the resources.
+//
+const char *WorldSnapshot::_DIRECTORY_ = "cache";
+
+const char WorldSnapshot::_MAGIC_[8] = {'S', 'G', 'R', 'W', 'O', 'R', 'L', 'D'};
+
+// Four different bytes, so any other byte order reads another value.
+//
+const uint32_t WorldSnapshot::_BYTE_ORDER_MARK_ = 0x01020304;
+
+// Layout of the header and the section table, the contents of the sections are covered by the
+// generator version of the key.
+//
+const uint32_t WorldSnapshot::_FORMAT_VERSION_ = 3;
+
+// Section alignment, a cache line and enough for any element type.
+//
+const uint64_t WorldSnapshot::_ALIGNMENT_ = 64;
+
+WorldSnapshot::WorldSnapshot(const WorldSnapshot::Key &_key) : _key_(_key) {}
+
+bool WorldSnapshot::Open()
+{
+    file_.Close();
+    std::error_code error;
+    if (!std::filesystem::exists(GetPath(), error))
+    {
+        return false;
+    }
+
+    // Writable, so writes to HAZELNUT_COLLECTED reach the file.
+    //
+    if (!file_.Open(GetPath(), true))
+    {
+        std::cout << "ERROR::WORLDSNAPSHOT::OPEN::MAP_FAILED " << GetPath() << std::endl;
+        return false;
+    }
+    if (!validate())
+    {
+        std::cout << "ERROR::WORLDSNAPSHOT::OPEN::STALE_OR_CORRUPT " << GetPath() << std::endl;
+        file_.Close();
+        return false;
+    }
+    return true;
+}
+
+bool WorldSnapshot::Write(const std::vector<WorldSnapshot::Section> &_sections)
+{
+    file_.Close();
+
+    Header header;
+    std::memset(&header, 0, sizeof(Header));
+    std::memcpy(header.magic, _MAGIC_, sizeof(_MAGIC_));
+    header.byte_order_mark = _BYTE_ORDER_MARK_;
+    header.format_version = _FORMAT_VERSION_;
+    header.seed = _key_.seed;
+    header.grid_size = _key_.grid_size;
+    header.height_scale = _key_.height_scale;
+    header.generator_version = _key_.generator_version;
+    header.section_count = (uint32_t)WSSECTIONenum::COUNT;
+
+    uint64_t offset = sizeof(Header);
+    for (std::size_t s = 0; s < _sections.size() && s < (std::size_t)WSSECTIONenum::COUNT; s++)
+    {
+        offset = (offset + _ALIGNMENT_ - 1) / _ALIGNMENT_ * _ALIGNMENT_;
+        header.sections[s].offset = offset;
+        header.sections[s].size = _sections[s].size;
+        offset += _sections[s].size;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(_DIRECTORY_, error);
+    const std::string path = GetPath();
+    const std::string temporary_path = path + ".tmp";
+    {
+        std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            std::cout << "ERROR::WORLDSNAPSHOT::WRITE::CANNOT_CREATE " << temporary_path
+                      << std::endl;
+            return false;
+        }
+        file.write((const char *)&header, sizeof(Header));
+        uint64_t position = sizeof(Header);
+        const char padding[64] = {};
+        for (std::size_t s = 0; s < _sections.size() && s < (std::size_t)WSSECTIONenum::COUNT; s++)
+        {
+            file.write(padding, (std::streamsize)(header.sections[s].offset - position));
+            file.write((const char *)_sections[s].data, (std::streamsize)_sections[s].size);
+            position = header.sections[s].offset + _sections[s].size;
+        }
+        if (!file)
+        {
+            std::cout << "ERROR::WORLDSNAPSHOT::WRITE::WRITE_FAILED " << temporary_path
+                      << std::endl;
+            file.close();
+            std::filesystem::remove(temporary_path, error);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(temporary_path, path, error);
+    if (error)
+    {
+        std::cout << "ERROR::WORLDSNAPSHOT::WRITE::RENAME_FAILED " << path << std::endl;
+        std::filesystem::remove(temporary_path, error);
+        return false;
+    }
+    return Open();
+}
+
+std::string WorldSnapshot::GetPath() const
+{
+    std::ostringstream path;
+    path << _DIRECTORY_ << "/world_" << _key_.seed << "_" << _key_.grid_size << "_h"
+         << _key_.height_scale << "_v" << _key_.generator_version << ".bin";
+    return path.str();
+}
+
+bool WorldSnapshot::validate()
+{
+    const uint64_t size = file_.GetSize();
+    if (size < sizeof(Header))
+    {
+        return false;
+    }
+    const Header *header = (const Header *)file_.GetData();
+    if (std::memcmp(header->magic, _MAGIC_, sizeof(_MAGIC_)) != 0 ||
+        header->byte_order_mark != _BYTE_ORDER_MARK_ ||
+        header->format_version != _FORMAT_VERSION_ || header->seed != _key_.seed ||
+        header->grid_size != _key_.grid_size || header->height_scale != _key_.height_scale ||
+        header->generator_version != _key_.generator_version ||
+        header->section_count != (uint32_t)WSSECTIONenum::COUNT)
+    {
+        return false;
+    }
+    for (const SectionEntry &entry : header->sections)
+    {
+        if (entry.offset % _ALIGNMENT_ != 0 || entry.offset > size ||
+            entry.size > size - entry.offset)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint8_t *WorldSnapshot::section(const WSSECTIONenum _section,
+                                const std::size_t _element_size,
+                                std::size_t &count) const
+{
+    count = 0;
+    if (!file_.IsOpen())
+    {
+        return nullptr;
+    }
+    const SectionEntry &entry = ((const Header *)file_.GetData())->sections[(std::size_t)_section];
+    if (entry.size == 0 || entry.size % _element_size != 0)
+    {
+        return nullptr;
+    }
+    count = (std::size_t)(entry.size / _element_size);
+    return file_.GetData() + entry.offset;
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Application/MappedFile.h"
+#include "Types/EWorldSnapshot.h"
+
+// A generated world in one binary file, loaded by mapping it into memory (see MappedFile).
+//
+// The file is keyed by the world seed, the grid size, the height scale and the generator
+// version, so a world is only generated once per key and any change to the generator
+// invalidates the old files. The height scale is part of the key as the ambient occlusion and
+// the instance transforms are baked for it. The file starts with a Header and is followed by
+// one section per WSSECTIONenum, each on a 64 byte boundary. The sections are plain arrays in
+// the layout the game uses, so the unit heights, the terrain vertices, the ambient occlusion
+// and the instance transforms are read, or handed to glBufferData, straight from the mapping
+// without parsing or copying them first. A missing section has size 0. The file is in the byte
+// order of the machine that wrote it, the byte order mark of the header rejects it on a
+// mismatch.
+//
+// HAZELNUT_COLLECTED is the only section changed after writing, it is mapped writable and
+// written through, so the collected hazelnuts stay collected on the next start.
+//
+class WorldSnapshot
+{
+public:
+    struct Key
+    {
+        uint32_t seed;
+        uint32_t grid_size;
+        float height_scale;
+        uint32_t generator_version;
+    };
+
+    struct Section
+    {
+        const void *data;
+        uint64_t size;
+    };
+
+    WorldSnapshot(const WorldSnapshot::Key &_key);
+    WorldSnapshot(const WorldSnapshot &) = delete;
+    WorldSnapshot &operator=(const WorldSnapshot &) = delete;
+
+    // Maps the file of the key. Fails, without an error, if there is none, and with one if it
+    // is truncated or was written for another key or format.
+    //
+    bool Open();
+
+    // Writes the file of the key, _sections in the order of WSSECTIONenum, and maps it. The
+    // file is written under a temporary name and renamed, so a crash never leaves a partial
+    // snapshot behind.
+    //
+    bool Write(const std::vector<WorldSnapshot::Section> &_sections);
+
+    bool IsOpen() const;
+    std::string GetPath() const;
+
+    // Start and element count of a section, nullptr and 0 if it is missing or the file is not
+    // open. The sections are only valid while the snapshot is.
+    //
+    template <typename T>
+    const T *GetSection(const WSSECTIONenum _section, std::size_t &count) const;
+    template <typename T> T *GetMutableSection(const WSSECTIONenum _section, std::size_t &count);
+
+private:
+    struct SectionEntry
+    {
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    struct Header
+    {
+        char magic[8];
+        // _BYTE_ORDER_MARK_ as written, reads differently in the other byte order.
+        //
+        uint32_t byte_order_mark;
+        uint32_t format_version;
+        uint32_t seed;
+        uint32_t grid_size;
+        float height_scale;
+        uint32_t generator_version;
+        uint32_t section_count;
+        uint32_t reserved;
+        SectionEntry sections[(std::size_t)WSSECTIONenum::COUNT];
+    };
+
+    const WorldSnapshot::Key _key_;
+    MappedFile file_;
+
+    static const char *_DIRECTORY_;
+    static const char _MAGIC_[8];
+    static const uint32_t _BYTE_ORDER_MARK_;
+    static const uint32_t _FORMAT_VERSION_;
+    static const uint64_t _ALIGNMENT_;
+
+    bool validate();
+    uint8_t *section(const WSSECTIONenum _section,
+                     const std::size_t _element_size,
+                     std::size_t &count) const;
+};
+
+inline bool WorldSnapshot::IsOpen() const { return file_.IsOpen(); }
+
+template <typename T>
+inline const T *WorldSnapshot::GetSection(const WSSECTIONenum _section, std::size_t &count) const
+{
+    return (const T *)section(_section, sizeof(T), count);
+}
+
+template <typename T>
+inline T *WorldSnapshot::GetMutableSection(const WSSECTIONenum _section, std::size_t &count)
+{
+    return (T *)section(_section, sizeof(T), count);
+}
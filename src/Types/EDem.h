@@ -0,0 +1,8 @@
+#pragma once
+
+enum class DEMFORMATenum
+{
+    RAW16_LE,
+    RAW16_BE,
+    PNG16
+};
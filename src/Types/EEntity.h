@@ -0,0 +1,17 @@
+#pragma once
+
+// The kinds of entities, the plants and the hazelnut in the order of the instance matrices
+// of GameWorld.
+//
+enum class ENTITYKINDenum
+{
+    TREE_1,
+    TREE_2,
+    TREE_3,
+    BUSH,
+    ROCK,
+    GRASS,
+    HAZELNUT,
+    PLAYER,
+    COUNT
+};
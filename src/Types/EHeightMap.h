@@ -0,0 +1,8 @@
+#pragma once
+
+enum class HMSOURCEenum
+{
+    CPU,
+    GPU,
+    GPU_VERIFIED
+};
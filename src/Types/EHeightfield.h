@@ -0,0 +1,7 @@
+#pragma once
+
+enum class HFFORMATenum
+{
+    FLOAT32,
+    UINT16
+};
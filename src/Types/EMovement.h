@@ -1,15 +1,15 @@
-#pragma once
-
-enum class MOVDIRenum
-{
-    FORWARD,
-    BACKWARD,
-    LEFT,
-    RIGHT
-};
-
-enum class MOVSPDenum
-{
-    NORMAL,
-    FAST
-};
+#pragma once
+
+enum class MOVDIRenum
+{
+    FORWARD,
+    BACKWARD,
+    LEFT,
+    RIGHT
+};
+
+enum class MOVSPDenum
+{
+    NORMAL,
+    FAST
+};
@@ -1,9 +1,9 @@
-#pragma once
-
-enum class SHTYPEenum
-{
-    VERTEX,
-    GEOMETRY,
-    FRAGMENT,
-    PROGRAM
-};
+#pragma once
+
+enum class SHTYPEenum
+{
+    VERTEX,
+    GEOMETRY,
+    FRAGMENT,
+    PROGRAM
+};
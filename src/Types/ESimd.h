@@ -0,0 +1,8 @@
+#pragma once
+
+enum class SIMDLEVELenum
+{
+    SCALAR,
+    SSE2,
+    AVX2
+};
@@ -1,7 +1,7 @@
-#pragma once
-
-enum class SKYBFORMATenum
-{
-    JPG,
-    PNG
-};
+#pragma once
+
+enum class SKYBFORMATenum
+{
+    JPG,
+    PNG
+};
@@ -0,0 +1,14 @@
+#pragma once
+
+enum class TERRAINMODEenum
+{
+    STATIC,
+    STREAMING
+};
+
+enum class TERRAINRENDERenum
+{
+    VERTEX_BUFFER,
+    HEIGHT_TEXTURE,
+    ADAPTIVE
+};
@@ -1,19 +1,19 @@
-#pragma once
-
-enum class TEXTYPEenum
-{
-    DIFFUSE,
-    SPECULAR,
-
-    NORMAL,
-    HEIGHT,
-
-    AMBIENT,
-    EMISSIVE
-};
-
-enum class TEXFORMATenum
-{
-    FILE,
-    EMBEDDED
-};
+#pragma once
+
+enum class TEXTYPEenum
+{
+    DIFFUSE,
+    SPECULAR,
+
+    NORMAL,
+    HEIGHT,
+
+    AMBIENT,
+    EMISSIVE
+};
+
+enum class TEXFORMATenum
+{
+    FILE,
+    EMBEDDED
+};
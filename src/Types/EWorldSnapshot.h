@@ -0,0 +1,17 @@
+#pragma once
+
+enum class WSSECTIONenum
+{
+    HEIGHTS,
+    TERRAIN_VERTICES,
+    AMBIENT_OCCLUSION,
+    TREE_1,
+    TREE_2,
+    TREE_3,
+    BUSH,
+    ROCK,
+    GRASS,
+    HAZELNUT,
+    HAZELNUT_COLLECTED,
+    COUNT
+};
@@ -1,7 +1,7 @@
-#pragma once
-
-#include <glad/glad.h>
-#include <GLFW/glfw3.h>
-
-typedef void (*FramebufferSizeCallbackFunction)(GLFWwindow *, int, int);
-typedef void (*MouseCallbackFunction)(GLFWwindow *, double, double);
+#pragma once
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+typedef void (*FramebufferSizeCallbackFunction)(GLFWwindow *, int, int);
+typedef void (*MouseCallbackFunction)(GLFWwindow *, double, double);
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "Types/AABB.h"
+
+// View frustum as six planes (a, b, c, d) with the normals pointing inwards, extracted from a
+// projection * view matrix (Gribb & Hartmann). A point p is inside a plane if
+// dot(plane.xyz, p) + plane.w >= 0.
+//
+class Frustum
+{
+public:
+    glm::vec4 planes[6];
+
+    Frustum();
+    Frustum(const glm::mat4 &projection_view);
+
+    bool Intersects(AABB box) const;
+};
+
+inline Frustum::Frustum()
+{
+    for (glm::vec4 &plane : planes)
+    {
+        plane = glm::vec4(0.0f);
+    }
+}
+
+inline Frustum::Frustum(const glm::mat4 &projection_view)
+{
+    // glm is column major, so row i of the matrix is (m[0][i], m[1][i], m[2][i], m[3][i]).
+    //
+    glm::mat4 m = glm::transpose(projection_view);
+    planes[0] = m[3] + m[0];
+    planes[1] = m[3] - m[0];
+    planes[2] = m[3] + m[1];
+    planes[3] = m[3] - m[1];
+    planes[4] = m[3] + m[2];
+    planes[5] = m[3] - m[2];
+    for (glm::vec4 &plane : planes)
+    {
+        plane /= glm::length(glm::vec3(plane));
+    }
+}
+
+// Conservative test, a box is only rejected if it lies fully behind one of the planes. Boxes
+// near the frustum corners may pass although they are outside, which is fine for culling.
+//
+inline bool Frustum::Intersects(AABB box) const
+{
+    glm::vec3 center = box.GetCenter();
+    glm::vec3 half_dims(box.x_half_dim, box.y_half_dim, box.z_half_dim);
+    for (const glm::vec4 &plane : planes)
+    {
+        float radius = glm::dot(half_dims, glm::abs(glm::vec3(plane)));
+        if (glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+        {
+            return false;
+        }
+    }
+    return true;
+}
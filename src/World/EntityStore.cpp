@@ -0,0 +1,256 @@
+#include "World/EntityStore.h"
+
+#if GOLD_RUSH_X86
+#include <immintrin.h>
+#endif
+
+const EntityStore::Handle EntityStore::_INVALID_HANDLE_ = {0xffffffffu, 0};
+
+const uint8_t EntityStore::_COLLECTIBLE_ = 1;
+
+namespace
+{
+// The columns and the range an overlap scan reads.
+//
+struct OverlapScan
+{
+    const float *center_x;
+    const float *center_z;
+    const float *half_x;
+    const float *half_z;
+    uint32_t count;
+    float range_x, range_z, range_half_x, range_half_z;
+};
+
+// Two boxes overlap along an axis if their centers are at most their half extents apart.
+// The vector kernels do the same operations in the same order, so all levels agree exactly.
+//
+template <class F> void overlapScalar(const OverlapScan &_scan, uint32_t _begin, F emit)
+{
+    for (uint32_t i = _begin; i < _scan.count; i++)
+    {
+        if (std::fabs(_scan.center_x[i] - _scan.range_x) <= _scan.half_x[i] + _scan.range_half_x &&
+            std::fabs(_scan.center_z[i] - _scan.range_z) <= _scan.half_z[i] + _scan.range_half_z)
+        {
+            emit(i);
+        }
+    }
+}
+
+#if GOLD_RUSH_X86
+template <class F> uint32_t overlapSse2(const OverlapScan &_scan, F emit)
+{
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    const __m128 range_x = _mm_set1_ps(_scan.range_x);
+    const __m128 range_z = _mm_set1_ps(_scan.range_z);
+    const __m128 range_half_x = _mm_set1_ps(_scan.range_half_x);
+    const __m128 range_half_z = _mm_set1_ps(_scan.range_half_z);
+
+    uint32_t i = 0;
+    for (; i + 4 <= _scan.count; i += 4)
+    {
+        __m128 dx = _mm_andnot_ps(sign, _mm_sub_ps(_mm_loadu_ps(_scan.center_x + i), range_x));
+        __m128 dz = _mm_andnot_ps(sign, _mm_sub_ps(_mm_loadu_ps(_scan.center_z + i), range_z));
+        __m128 in_x = _mm_cmple_ps(dx, _mm_add_ps(_mm_loadu_ps(_scan.half_x + i), range_half_x));
+        __m128 in_z = _mm_cmple_ps(dz, _mm_add_ps(_mm_loadu_ps(_scan.half_z + i), range_half_z));
+        int mask = _mm_movemask_ps(_mm_and_ps(in_x, in_z));
+        for (uint32_t lane = 0; mask != 0; lane++, mask >>= 1)
+        {
+            if (mask & 1)
+            {
+                emit(i + lane);
+            }
+        }
+    }
+    return i;
+}
+
+template <class F> GOLD_RUSH_TARGET_AVX2 uint32_t overlapAvx2(const OverlapScan &_scan, F emit)
+{
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    const __m256 range_x = _mm256_set1_ps(_scan.range_x);
+    const __m256 range_z = _mm256_set1_ps(_scan.range_z);
+    const __m256 range_half_x = _mm256_set1_ps(_scan.range_half_x);
+    const __m256 range_half_z = _mm256_set1_ps(_scan.range_half_z);
+
+    uint32_t i = 0;
+    for (; i + 8 <= _scan.count; i += 8)
+    {
+        __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(_scan.center_x + i), range_x);
+        __m256 dz = _mm256_sub_ps(_mm256_loadu_ps(_scan.center_z + i), range_z);
+        dx = _mm256_andnot_ps(sign, dx);
+        dz = _mm256_andnot_ps(sign, dz);
+        __m256 in_x = _mm256_cmp_ps(
+            dx, _mm256_add_ps(_mm256_loadu_ps(_scan.half_x + i), range_half_x), _CMP_LE_OQ);
+        __m256 in_z = _mm256_cmp_ps(
+            dz, _mm256_add_ps(_mm256_loadu_ps(_scan.half_z + i), range_half_z), _CMP_LE_OQ);
+        int mask = _mm256_movemask_ps(_mm256_and_ps(in_x, in_z));
+        for (uint32_t lane = 0; mask != 0; lane++, mask >>= 1)
+        {
+            if (mask & 1)
+            {
+                emit(i + lane);
+            }
+        }
+    }
+    return i;
+}
+#endif
+} // namespace
+
+EntityStore::EntityStore() {}
+
+void EntityStore::Reserve(const uint32_t _count)
+{
+    center_x_.reserve(_count);
+    center_y_.reserve(_count);
+    center_z_.reserve(_count);
+    half_x_.reserve(_count);
+    half_y_.reserve(_count);
+    half_z_.reserve(_count);
+    flags_.reserve(_count);
+    kinds_.reserve(_count);
+    transforms_.reserve(_count);
+    handles_.reserve(_count);
+    indices_.reserve(_count);
+    generations_.reserve(_count);
+}
+
+EntityStore::Handle EntityStore::Create(Entity entity)
+{
+    EntityStore::Handle handle;
+    if (!free_slots_.empty())
+    {
+        handle.slot = free_slots_.back();
+        free_slots_.pop_back();
+    }
+    else
+    {
+        handle.slot = (uint32_t)indices_.size();
+        indices_.push_back(0);
+        generations_.push_back(0);
+    }
+    handle.generation = generations_[handle.slot];
+    indices_[handle.slot] = GetCount();
+
+    const AABB &bounding_box = entity.bounding_box_;
+    center_x_.push_back(bounding_box.center_position.x);
+    center_y_.push_back(bounding_box.center_position.y);
+    center_z_.push_back(bounding_box.center_position.z);
+    half_x_.push_back(bounding_box.x_half_dim);
+    half_y_.push_back(bounding_box.y_half_dim);
+    half_z_.push_back(bounding_box.z_half_dim);
+    flags_.push_back(entity.is_collectible_ ? _COLLECTIBLE_ : 0);
+    kinds_.push_back((uint8_t)entity.kind_);
+    transforms_.push_back(entity.GetModelMatrix());
+    handles_.push_back(handle);
+    return handle;
+}
+
+void EntityStore::Remove(const EntityStore::Handle _handle)
+{
+    if (!IsAlive(_handle))
+    {
+        std::cout << "ERROR::ENTITYSTORE::REMOVE::INVALID_HANDLE " << _handle.slot << " "
+                  << _handle.generation << std::endl;
+        return;
+    }
+
+    // The last entity takes the place of the removed one.
+    //
+    const uint32_t index = indices_[_handle.slot];
+    const uint32_t last = GetCount() - 1;
+    center_x_[index] = center_x_[last];
+    center_y_[index] = center_y_[last];
+    center_z_[index] = center_z_[last];
+    half_x_[index] = half_x_[last];
+    half_y_[index] = half_y_[last];
+    half_z_[index] = half_z_[last];
+    flags_[index] = flags_[last];
+    kinds_[index] = kinds_[last];
+    transforms_[index] = transforms_[last];
+    handles_[index] = handles_[last];
+    indices_[handles_[index].slot] = index;
+
+    center_x_.pop_back();
+    center_y_.pop_back();
+    center_z_.pop_back();
+    half_x_.pop_back();
+    half_y_.pop_back();
+    half_z_.pop_back();
+    flags_.pop_back();
+    kinds_.pop_back();
+    transforms_.pop_back();
+    handles_.pop_back();
+    generations_[_handle.slot]++;
+    free_slots_.push_back(_handle.slot);
+}
+
+void EntityStore::SetTranslation(const EntityStore::Handle _handle, const glm::vec3 &_translation)
+{
+    if (!IsAlive(_handle))
+    {
+        std::cout << "ERROR::ENTITYSTORE::SET_TRANSLATION::INVALID_HANDLE " << _handle.slot << " "
+                  << _handle.generation << std::endl;
+        return;
+    }
+
+    const uint32_t index = indices_[_handle.slot];
+    const glm::vec3 offset = _translation - glm::vec3(transforms_[index][3]);
+    center_x_[index] += offset.x;
+    center_y_[index] += offset.y;
+    center_z_[index] += offset.z;
+    transforms_[index][3] = glm::vec4(_translation, 1.0f);
+}
+
+AABB EntityStore::GetBoundingBox(const EntityStore::Handle _handle) const
+{
+    const uint32_t index = indices_[_handle.slot];
+    return AABB(glm::vec3(center_x_[index], center_y_[index], center_z_[index]),
+                half_x_[index],
+                half_y_[index],
+                half_z_[index]);
+}
+
+uint32_t EntityStore::Overlapping(AABB range,
+                                  const uint32_t _kind_mask,
+                                  EntityStore::Handle *handles,
+                                  const uint32_t _capacity,
+                                  const SIMDLEVELenum _simd_level) const
+{
+    const OverlapScan scan = {center_x_.data(),
+                              center_z_.data(),
+                              half_x_.data(),
+                              half_z_.data(),
+                              GetCount(),
+                              range.center_position.x,
+                              range.center_position.z,
+                              range.x_half_dim,
+                              range.z_half_dim};
+    uint32_t count = 0;
+    auto emit = [&](uint32_t i) {
+        if ((_kind_mask >> kinds_[i] & 1) == 0)
+        {
+            return;
+        }
+        if (count < _capacity)
+        {
+            handles[count] = handles_[i];
+        }
+        count++;
+    };
+
+    uint32_t begin = 0;
+#if GOLD_RUSH_X86
+    if (_simd_level == SIMDLEVELenum::AVX2)
+    {
+        begin = overlapAvx2(scan, emit);
+    }
+    else if (_simd_level == SIMDLEVELenum::SSE2)
+    {
+        begin = overlapSse2(scan, emit);
+    }
+#endif
+    overlapScalar(scan, begin, emit);
+    return count;
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Application/CpuFeatures.h"
+#include "Game/Entity.h"
+#include "Types/AABB.h"
+#include "Types/EEntity.h"
+#include "Types/ESimd.h"
+
+// The entities of the world as a structure of arrays.
+//
+// Every component lives in its own tightly packed array, the centers and the half extents one
+// array per axis, so a system that only needs the positions of the entities streams through
+// just those and the scans work on 4 or 8 entities per instruction. The arrays are dense, an
+// entity is created at the end and removing one moves the last entity into its place.
+//
+// An entity is referred to by a handle, which stays valid until the entity is removed, no
+// matter how the dense arrays are reordered. The dense index of a handle is only valid until
+// the next Remove. A handle is a slot and the generation of the slot, removing an entity frees
+// its slot for reuse and bumps the generation, so a handle kept past the removal is never
+// mistaken for the entity that reuses its slot.
+//
+class EntityStore
+{
+public:
+    struct Handle
+    {
+        uint32_t slot;
+        uint32_t generation;
+
+        bool operator==(const EntityStore::Handle &_other) const;
+        bool operator!=(const EntityStore::Handle &_other) const;
+    };
+
+    static const EntityStore::Handle _INVALID_HANDLE_;
+
+    // Flag bits.
+    //
+    static const uint8_t _COLLECTIBLE_;
+
+    EntityStore();
+
+    void Reserve(const uint32_t _count);
+    EntityStore::Handle Create(Entity entity);
+    void Remove(const EntityStore::Handle _handle);
+    bool IsAlive(const EntityStore::Handle _handle) const;
+
+    // Moves an entity so its transform has the translation _translation, its bounding box
+    // moves along.
+    //
+    void SetTranslation(const EntityStore::Handle _handle, const glm::vec3 &_translation);
+
+    uint32_t GetCount() const;
+
+    // Slots ever handed out, every handle has a slot below, so arrays indexed by the slot of
+    // a handle are this long.
+    //
+    uint32_t GetSlotCount() const;
+    uint32_t GetIndex(const EntityStore::Handle _handle) const;
+
+    // The components by dense index, GetCount() of each.
+    //
+    const float *GetCentersX() const;
+    const float *GetCentersY() const;
+    const float *GetCentersZ() const;
+    const float *GetHalfExtentsX() const;
+    const float *GetHalfExtentsY() const;
+    const float *GetHalfExtentsZ() const;
+    const uint8_t *GetFlags() const;
+    const uint8_t *GetKinds() const;
+    const glm::mat4 *GetTransforms() const;
+    const EntityStore::Handle *GetHandles() const;
+
+    AABB GetBoundingBox(const EntityStore::Handle _handle) const;
+    const glm::mat4 &GetTransform(const EntityStore::Handle _handle) const;
+    ENTITYKINDenum GetKind(const EntityStore::Handle _handle) const;
+    bool IsCollectible(const EntityStore::Handle _handle) const;
+
+    // Writes up to _capacity handles of the entities whose bounding box overlaps range in X
+    // and Z and whose kind is in _kind_mask (see QuadTree::KindMask), in dense order, and
+    // returns how many there are in total.
+    //
+    uint32_t Overlapping(AABB range,
+                         const uint32_t _kind_mask,
+                         EntityStore::Handle *handles,
+                         const uint32_t _capacity,
+                         const SIMDLEVELenum _simd_level = CpuFeatures::GetSimdLevel()) const;
+
+private:
+    std::vector<float> center_x_, center_y_, center_z_;
+    std::vector<float> half_x_, half_y_, half_z_;
+    std::vector<uint8_t> flags_;
+    std::vector<uint8_t> kinds_;
+    std::vector<glm::mat4> transforms_;
+    std::vector<EntityStore::Handle> handles_;
+
+    // Dense index and generation of every slot. The slots of removed entities are reused from
+    // free_slots_.
+    //
+    std::vector<uint32_t> indices_;
+    std::vector<uint32_t> generations_;
+    std::vector<uint32_t> free_slots_;
+};
+
+inline bool EntityStore::Handle::operator==(const EntityStore::Handle &_other) const
+{
+    return slot == _other.slot && generation == _other.generation;
+}
+
+inline bool EntityStore::Handle::operator!=(const EntityStore::Handle &_other) const
+{
+    return !(*this == _other);
+}
+
+inline bool EntityStore::IsAlive(const EntityStore::Handle _handle) const
+{
+    return _handle.slot < generations_.size() && generations_[_handle.slot] == _handle.generation;
+}
+
+inline uint32_t EntityStore::GetCount() const { return (uint32_t)handles_.size(); }
+
+inline uint32_t EntityStore::GetSlotCount() const { return (uint32_t)indices_.size(); }
+
+inline uint32_t EntityStore::GetIndex(const EntityStore::Handle _handle) const
+{
+    return indices_[_handle.slot];
+}
+
+inline const float *EntityStore::GetCentersX() const { return center_x_.data(); }
+
+inline const float *EntityStore::GetCentersY() const { return center_y_.data(); }
+
+inline const float *EntityStore::GetCentersZ() const { return center_z_.data(); }
+
+inline const float *EntityStore::GetHalfExtentsX() const { return half_x_.data(); }
+
+inline const float *EntityStore::GetHalfExtentsY() const { return half_y_.data(); }
+
+inline const float *EntityStore::GetHalfExtentsZ() const { return half_z_.data(); }
+
+inline const uint8_t *EntityStore::GetFlags() const { return flags_.data(); }
+
+inline const uint8_t *EntityStore::GetKinds() const { return kinds_.data(); }
+
+inline const glm::mat4 *EntityStore::GetTransforms() const { return transforms_.data(); }
+
+inline const EntityStore::Handle *EntityStore::GetHandles() const { return handles_.data(); }
+
+inline const glm::mat4 &EntityStore::GetTransform(const EntityStore::Handle _handle) const
+{
+    return transforms_[indices_[_handle.slot]];
+}
+
+inline ENTITYKINDenum EntityStore::GetKind(const EntityStore::Handle _handle) const
+{
+    return (ENTITYKINDenum)kinds_[indices_[_handle.slot]];
+}
+
+inline bool EntityStore::IsCollectible(const EntityStore::Handle _handle) const
+{
+    return (flags_[indices_[_handle.slot]] & _COLLECTIBLE_) != 0;
+}
@@ -1,174 +1,401 @@
-#include "GameWorld.h"
-
-GameWorld::GameWorld(glm::vec3 sun_position, uint32_t grid_size_)
-    : _grid_size_(grid_size_), terrain_(Terrain(grid_size_)),
-      skybox_(Skybox("src/Resources/Skyboxes/Fantasy_01/", SKYBFORMATenum::PNG)),
-      quad_tree_(AABB(glm::vec3(0.0f), (float)grid_size_)),
-      shader_terrain_(Shader("src/Resources/Shaders/Terrain/lowPolyTerrain.vert",
-                             "src/Resources/Shaders/Terrain/lowPolyTerrain.frag")),
-      shader_skybox_(Shader("src/Resources/Shaders/Skybox/fantasySkybox.vert",
-                            "src/Resources/Shaders/Skybox/fantasySkybox.frag")),
-      shader_entity_(Shader("src/Resources/Shaders/Model/lowPolyModel.vert",
-                            "src/Resources/Shaders/Model/lowPolyModel.frag")),
-      trrel_tree_1_(Model("src/Resources/Models/tree_1/tree_1.obj", true), shader_entity_),
-      trrel_tree_2_(Model("src/Resources/Models/tree_2/tree_2.obj", true), shader_entity_),
-      trrel_tree_3_(Model("src/Resources/Models/tree_3/tree_3.obj", true), shader_entity_),
-      trrel_bush_(Model("src/Resources/Models/lil_bush/lil_bush.obj", true), shader_entity_),
-      trrel_rock_(Model("src/Resources/Models/rock/rock.obj", true), shader_entity_),
-      trrel_grass_(Model("src/Resources/Models/grass_bud/grass_bud.obj", true), shader_entity_),
-      trrel_hazelnut_(Model("src/Resources/Models/hazelnut/hazelnut.obj", true), shader_entity_),
-      sun_position_(sun_position)
-{
-    grid_ = terrain_.GetGrid();
-    setupModelMatsAll();
-    createGameEntities();
-    createQuadTree();
-    createModelMatPairs();
-    createIndexMap();
-}
-
-void GameWorld::Draw()
-{
-    drawTerrain();
-    drawSkybox();
-    drawWoodland();
-}
-
-void GameWorld::setupModelMatsAll()
-{
-    model_mats_all_.push_back(terrain_.GetTree1ModelMats());
-    model_mats_all_.push_back(terrain_.GetTree2ModelMats());
-    model_mats_all_.push_back(terrain_.GetTree3ModelMats());
-    model_mats_all_.push_back(terrain_.GetBushModelMats());
-    model_mats_all_.push_back(terrain_.GetRockModelMats());
-    model_mats_all_.push_back(terrain_.GetGrassModelMats());
-    model_mats_all_.push_back(terrain_.GetHazelnutMats());
-}
-
-glm::vec3 &GameWorld::GetSunPosition() { return sun_position_; }
-
-void GameWorld::SetSunPosition(glm::vec3 new_sun_pos) { sun_position_ = new_sun_pos; }
-
-void GameWorld::RemoveCollectibles(std::vector<Entity> collectibles, Player &player)
-{
-    if (collectibles.empty())
-    {
-        return;
-    }
-    for (std::size_t i = 0; i < collectibles.size(); i++)
-    {
-        if (hazelnut_index_map_.find(collectibles.at(i).GetModelMatrix()) !=
-            hazelnut_index_map_.end())
-        {
-            std::vector<glm::mat4>::iterator index =
-                model_mats_all_.at(6)->begin() +
-                hazelnut_index_map_.at(collectibles.at(i).GetModelMatrix());
-            model_mats_all_.at(6)->erase(index);
-            player.UpdateScore();
-            createModelMatPairs();
-            createIndexMap();
-        }
-    }
-}
-
-float GameWorld::GetGridHeight(glm::vec3 player_pos)
-{
-    int64_t grid_size, grid_center, mod_i, i, mod_j, j;
-    // Starting grid width height is (128, 128)
-    // Generate map of (128, 128) and scale positions by 2, map still (128, 128), but corrdinates
-    // from [0, 256] Translate map by grid width in -x and -z directions, so coordiantes are now
-    // [-128, 128] Center of height map is at index (64, 64) since it's scaled * 2 and translated
-    //
-    grid_size = (int64_t)_grid_size_;
-    grid_center = grid_size / 2;
-    j = grid_center + (int64_t)((double)player_pos.z / 2.0);
-    i = grid_center + (int64_t)((double)player_pos.x / 2.0);
-
-    // Interpolate between the four nearest positions
-    //
-    float p0, p1, p2, p3;
-
-    // Make sure we don't get a std::out_of_range exception.
-    //
-    mod_i = (i - 1 < 0) ? 0 : i - 1;
-    mod_j = (j - 1 < 0) ? 0 : j - 1;
-    p0 = grid_->at(mod_i * grid_size + j).y;
-    p2 = grid_->at(i * grid_size + mod_j).y;
-    mod_i = (i + 1 > grid_size) ? grid_size : i + 1;
-    mod_j = (j + 1 > grid_size) ? grid_size : j + 1;
-    p1 = grid_->at(i * grid_size + mod_j).y;
-    p3 = grid_->at(mod_i * grid_size + j).y;
-
-    return (p0 + p1 + p2 + p3) / 4.0f;
-}
-
-void GameWorld::createGameEntities()
-{
-    for (std::size_t i = 0; i < model_mats_all_.at(0)->size(); i++)
-    {
-        game_entities_.push_back(Entity(trrel_tree_1_, model_mats_all_.at(0)->at(i)));
-    }
-    for (std::size_t i = 0; i < model_mats_all_.at(1)->size(); i++)
-    {
-        game_entities_.push_back(Entity(trrel_tree_2_, model_mats_all_.at(1)->at(i)));
-    }
-    for (std::size_t i = 0; i < model_mats_all_.at(2)->size(); i++)
-    {
-        game_entities_.push_back(Entity(trrel_tree_3_, model_mats_all_.at(2)->at(i)));
-    }
-    for (std::size_t i = 0; i < model_mats_all_.at(3)->size(); i++)
-    {
-        game_entities_.push_back(Entity(trrel_bush_, model_mats_all_.at(3)->at(i)));
-    }
-    for (std::size_t i = 0; i < model_mats_all_.at(4)->size(); i++)
-    {
-        game_entities_.push_back(Entity(trrel_rock_, model_mats_all_.at(4)->at(i)));
-    }
-    for (std::size_t i = 0; i < model_mats_all_.at(5)->size(); i++)
-    {
-        game_entities_.push_back(Entity(trrel_grass_, model_mats_all_.at(5)->at(i)));
-    }
-    for (std::size_t i = 0; i < model_mats_all_.at(6)->size(); i++)
-    {
-        game_entities_.push_back(Entity(trrel_hazelnut_, model_mats_all_.at(6)->at(i), true));
-    }
-}
-
-void GameWorld::createQuadTree()
-{
-    for (std::size_t i = 0; i < game_entities_.size(); i++)
-    {
-        quad_tree_.Insert(game_entities_.at(i));
-    }
-}
-
-void GameWorld::createModelMatPairs()
-{
-    hazelnut_model_mats_pairs_.clear();
-    for (std::size_t i = 0; i < model_mats_all_.at(6)->size(); i++)
-    {
-        hazelnut_model_mats_pairs_.push_back(std::make_pair(model_mats_all_.at(6)->at(i), i));
-    }
-}
-
-void GameWorld::createIndexMap()
-{
-    hazelnut_index_map_.clear();
-    hazelnut_index_map_ = std::unordered_map<glm::mat4, int>(hazelnut_model_mats_pairs_.begin(),
-                                                             hazelnut_model_mats_pairs_.end());
-}
-
-void GameWorld::drawTerrain() { terrain_.Draw(shader_terrain_); }
-
-void GameWorld::drawSkybox() { skybox_.Draw(shader_skybox_); }
-
-void GameWorld::drawWoodland()
-{
-    trrel_tree_1_.DrawInstanced(model_mats_all_.at(0));
-    trrel_tree_2_.DrawInstanced(model_mats_all_.at(1));
-    trrel_tree_3_.DrawInstanced(model_mats_all_.at(2));
-    trrel_bush_.DrawInstanced(model_mats_all_.at(3));
-    trrel_rock_.DrawInstanced(model_mats_all_.at(4));
-    trrel_grass_.DrawInstanced(model_mats_all_.at(5));
-    trrel_hazelnut_.DrawInstanced(model_mats_all_.at(6));
-}
+#include "GameWorld.h"
+
+// Distance the follow camera keeps from the terrain surface.
+//
+const float GameWorld::_CAMERA_CLEARANCE_ = 0.5f;
+
+// Radius of the terrain deformation brush, in world units.
+//
+const float GameWorld::_BRUSH_RADIUS_ = 4.0f;
+
+// World height of unit terrain height 1, for the static and the streamed terrain.
+//
+const float GameWorld::_TERRAIN_HEIGHT_SCALE_ = 10.0f;
+
+// Most hazelnuts collected in one frame, the rest are collected in the next ones.
+//
+const uint32_t GameWorld::_PICKUP_CAPACITY_ = 16;
+
+GameWorld::GameWorld(uint32_t world_seed,
+                     glm::vec3 sun_position,
+                     uint32_t grid_size_,
+                     TERRAINMODEenum terrain_mode,
+                     TERRAINRENDERenum terrain_render,
+                     const std::string &dem_path)
+    : _world_seed_(world_seed), _grid_size_(grid_size_), _terrain_mode_(terrain_mode),
+      _terrain_render_(effectiveTerrainRender(terrain_mode, terrain_render)), _dem_path_(dem_path),
+      skybox_(Skybox("src/Resources/Skyboxes/Fantasy_01/", SKYBFORMATenum::PNG)),
+      quad_tree_(AABB(glm::vec3(0.0f), (float)grid_size_)),
+      shader_terrain_(
+          Shader(terrainVertexShader(_terrain_render_), terrainFragmentShader(_terrain_render_))),
+      shader_skybox_(Shader("src/Resources/Shaders/Skybox/fantasySkybox.vert",
+                            "src/Resources/Shaders/Skybox/fantasySkybox.frag")),
+      shader_entity_(Shader("src/Resources/Shaders/Model/lowPolyModel.vert",
+                            "src/Resources/Shaders/Model/lowPolyModel.frag")),
+      trrel_tree_1_(Model("src/Resources/Models/tree_1/tree_1.obj", true), shader_entity_),
+      trrel_tree_2_(Model("src/Resources/Models/tree_2/tree_2.obj", true), shader_entity_),
+      trrel_tree_3_(Model("src/Resources/Models/tree_3/tree_3.obj", true), shader_entity_),
+      trrel_bush_(Model("src/Resources/Models/lil_bush/lil_bush.obj", true), shader_entity_),
+      trrel_rock_(Model("src/Resources/Models/rock/rock.obj", true), shader_entity_),
+      trrel_grass_(Model("src/Resources/Models/grass_bud/grass_bud.obj", true), shader_entity_),
+      trrel_hazelnut_(Model("src/Resources/Models/hazelnut/hazelnut.obj", true), shader_entity_),
+      sun_position_(sun_position)
+{
+    setupTerrain();
+    setupTerrainPalette();
+    setupModelMatsAll();
+    createGameEntities();
+    createQuadTree();
+    createInstanceBuffers();
+}
+
+void GameWorld::Update(Player &player)
+{
+    if (_terrain_mode_ != TERRAINMODEenum::STREAMING)
+    {
+        return;
+    }
+
+    // Streamed hazelnuts are not in the quad tree, they are collected by the streamer.
+    //
+    terrain_streamer_->Update(player.position_);
+    uint32_t collected = terrain_streamer_->Collect(player.GetBoundingBox());
+    for (uint32_t i = 0; i < collected; i++)
+    {
+        player.UpdateScore();
+    }
+}
+
+void GameWorld::ResolveCameraCollision(Camera &camera)
+{
+    // Start from the unobstructed follow position every frame, so the camera moves back out
+    // once the terrain no longer blocks it. The target is the point the camera looks at.
+    //
+    camera.FollowPlayer();
+    glm::vec3 target = camera.player_position_ + glm::vec3(0.0f, 1.5f, 0.0f);
+
+    // The streamed terrain has no pyramid, there the camera is only kept above the ground.
+    //
+    if (_terrain_mode_ == TERRAINMODEenum::STATIC)
+    {
+        glm::vec3 direction = camera.position_ - target;
+        float length = glm::length(direction);
+        float distance;
+        if (length > 0.0f &&
+            terrain_->GetHeightPyramid()->Raycast(target, direction, length, distance))
+        {
+            distance = std::max(distance - _CAMERA_CLEARANCE_, 0.0f);
+            camera.position_ = target + direction / length * distance;
+        }
+    }
+
+    float ground = GetGridHeight(camera.position_) + _CAMERA_CLEARANCE_;
+    camera.position_.y = std::max(camera.position_.y, ground);
+}
+
+void GameWorld::DeformTerrain(const glm::vec3 &_center, const float _amount)
+{
+    if (_terrain_mode_ == TERRAINMODEenum::STREAMING)
+    {
+        std::cout << "ERROR::GAMEWORLD::DEFORM_TERRAIN::STREAMED_TERRAIN_IS_STATIC" << std::endl;
+        return;
+    }
+
+    // Only the instances that followed the ground are uploaded again, and their entities are
+    // moved with them. The kinds are in the order of the terrain in ENTITYKINDenum.
+    //
+    for (const Terrain::VegetationRef &ref : terrain_->Deform(_center, _BRUSH_RADIUS_, _amount))
+    {
+        const glm::mat4 &model_mat = model_mats_all_.at(ref.kind)->at(ref.index);
+        instance_buffers_.at(ref.kind)->Set(ref.index, model_mat);
+
+        const EntityStore::Handle entity = instance_handles_.at(ref.kind)[ref.index];
+        game_entities_.SetTranslation(entity, glm::vec3(model_mat[3]));
+        quad_tree_.SetHeight(entity, game_entities_.GetBoundingBox(entity).center_position.y);
+    }
+}
+
+void GameWorld::Draw(const Camera &camera)
+{
+    drawTerrain(camera);
+    drawSkybox();
+    drawWoodland();
+}
+
+void GameWorld::setupTerrain()
+{
+    if (_terrain_mode_ == TERRAINMODEenum::STATIC)
+    {
+        if (!_dem_path_.empty())
+        {
+            std::cout << "ERROR::GAMEWORLD::SETUP_TERRAIN::DEM_NEEDS_STREAMING" << std::endl;
+        }
+        terrain_ = std::make_shared<Terrain>(
+            _world_seed_, _grid_size_, _TERRAIN_HEIGHT_SCALE_, HMSOURCEenum::CPU, _terrain_render_);
+        return;
+    }
+
+    NoiseGenerator::Settings settings;
+    settings.seed = _world_seed_;
+    settings.octaves = 6;
+    settings.bias = 0.2f;
+    settings.pitch = (int)_grid_size_;
+    settings.wrap = 0;
+    std::shared_ptr<DemSource> dem;
+    if (!_dem_path_.empty())
+    {
+        const bool is_png = std::filesystem::path(_dem_path_).extension() == ".png";
+        dem = std::make_shared<DemSource>(
+            _dem_path_, is_png ? DEMFORMATenum::PNG16 : DEMFORMATenum::RAW16_LE);
+        if (!dem->IsOpen())
+        {
+            dem = nullptr;
+        }
+    }
+    terrain_streamer_ = std::make_shared<TerrainStreamer>(settings,
+                                                          _grid_size_,
+                                                          _TERRAIN_HEIGHT_SCALE_,
+                                                          2,
+                                                          48 * 1024 * 1024,
+                                                          _terrain_render_,
+                                                          dem);
+    terrain_streamer_->Preload(glm::vec3(0.0f));
+}
+
+void GameWorld::setupTerrainPalette()
+{
+    // The TerrainPalette block of lowPolyTerrain.frag. The colors are from
+    // Resources/Colors/colors.txt, the generated heights have their median around 0.5 and the
+    // steepest 5% of the default grid have a slope above 0.4.
+    //
+    terrain_palette_ = {
+        glm::vec4(0.59f, 0.65f, 0.38f, 1.0f),
+        glm::vec4(0.364f, 0.729f, 0.254f, 1.0f),
+        glm::vec4(0.36f, 0.45f, 0.22f, 1.0f),
+        glm::vec4(0.26f, 0.34f, 0.17f, 1.0f),
+        glm::vec4(0.71f, 0.73f, 0.49f, 1.0f),
+        glm::vec4(0.48f, 0.54f, 0.29f, 1.0f),
+        glm::vec4(0.3f, 0.5f, 0.65f, 0.8f),
+        glm::vec4(_TERRAIN_HEIGHT_SCALE_, 0.03f, 0.3f, 0.4f),
+    };
+}
+
+void GameWorld::setupModelMatsAll()
+{
+    // The streamer refills its vectors in place, so the entities and the quad tree built from
+    // them stay empty and the woodland is drawn from whatever is resident.
+    //
+    if (_terrain_mode_ == TERRAINMODEenum::STREAMING)
+    {
+        model_mats_all_ = terrain_streamer_->GetModelMats();
+        return;
+    }
+
+    model_mats_all_.push_back(terrain_->GetTree1ModelMats());
+    model_mats_all_.push_back(terrain_->GetTree2ModelMats());
+    model_mats_all_.push_back(terrain_->GetTree3ModelMats());
+    model_mats_all_.push_back(terrain_->GetBushModelMats());
+    model_mats_all_.push_back(terrain_->GetRockModelMats());
+    model_mats_all_.push_back(terrain_->GetGrassModelMats());
+    model_mats_all_.push_back(terrain_->GetHazelnutMats());
+}
+
+glm::vec3 &GameWorld::GetSunPosition() { return sun_position_; }
+
+std::vector<glm::vec4> &GameWorld::GetTerrainPalette() { return terrain_palette_; }
+
+void GameWorld::SetSunPosition(glm::vec3 new_sun_pos) { sun_position_ = new_sun_pos; }
+
+void GameWorld::RemoveCollectibles(Player &player)
+{
+    // Runs every frame, the query allocates nothing and only walks the nodes with hazelnuts.
+    // The tree cannot change under a query, so the hazelnuts are removed after it.
+    //
+    std::array<EntityStore::Handle, _PICKUP_CAPACITY_> hazelnuts;
+    const uint32_t count = std::min(quad_tree_.Query(player.GetBoundingBox(),
+                                                     QuadTree::KindMask(ENTITYKINDenum::HAZELNUT),
+                                                     hazelnuts.data(),
+                                                     _PICKUP_CAPACITY_),
+                                    _PICKUP_CAPACITY_);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        collectHazelnut(hazelnuts[i]);
+        player.UpdateScore();
+    }
+}
+
+float GameWorld::GetGridHeight(glm::vec3 player_pos)
+{
+    if (_terrain_mode_ == TERRAINMODEenum::STREAMING)
+    {
+        return terrain_streamer_->GetHeight(player_pos);
+    }
+
+    // Interpolated on the triangle below the player, so the player follows the drawn mesh.
+    //
+    return terrain_->GetHeight(player_pos);
+}
+
+void GameWorld::createGameEntities()
+{
+    // The streamed vegetation and hazelnuts are not entities, see setupModelMatsAll.
+    //
+    if (_terrain_mode_ == TERRAINMODEenum::STREAMING)
+    {
+        return;
+    }
+
+    // The entities of a kind share its TerrainElement, they only copy its bounding box.
+    //
+    std::size_t count = 0;
+    for (std::size_t k = 0; k < model_mats_all_.size(); k++)
+    {
+        count += model_mats_all_.at(k)->size();
+    }
+    game_entities_.Reserve((uint32_t)count);
+    instance_handles_.resize(model_mats_all_.size());
+    for (std::size_t k = 0; k < model_mats_all_.size(); k++)
+    {
+        const ENTITYKINDenum kind = (ENTITYKINDenum)k;
+        const AABB model_bounding_box = archetype(kind).GetModelBoundingBox();
+        for (std::size_t i = 0; i < model_mats_all_.at(k)->size(); i++)
+        {
+            const bool is_hazelnut = kind == ENTITYKINDenum::HAZELNUT;
+            instance_handles_.at(k).push_back(game_entities_.Create(
+                Entity(model_bounding_box, model_mats_all_.at(k)->at(i), kind, is_hazelnut)));
+        }
+    }
+
+    const std::vector<EntityStore::Handle> &hazelnut_handles =
+        instance_handles_.at((std::size_t)ENTITYKINDenum::HAZELNUT);
+    hazelnut_instances_.resize(game_entities_.GetSlotCount());
+    hazelnut_snapshot_indices_.resize(game_entities_.GetSlotCount());
+    for (uint32_t i = 0; i < (uint32_t)hazelnut_handles.size(); i++)
+    {
+        hazelnut_instances_[hazelnut_handles[i].slot] = i;
+        hazelnut_snapshot_indices_[hazelnut_handles[i].slot] = terrain_->GetHazelnutIndices()[i];
+    }
+}
+
+void GameWorld::createQuadTree() { quad_tree_.Build(game_entities_); }
+
+void GameWorld::createInstanceBuffers()
+{
+    if (_terrain_mode_ == TERRAINMODEenum::STREAMING)
+    {
+        return;
+    }
+    for (std::size_t k = 0; k < model_mats_all_.size(); k++)
+    {
+        instance_buffers_.push_back(std::make_shared<InstanceBuffer>());
+        instance_buffers_.back()->Data(*model_mats_all_.at(k));
+    }
+}
+
+void GameWorld::collectHazelnut(const EntityStore::Handle _hazelnut)
+{
+    terrain_->Collect(hazelnut_snapshot_indices_[_hazelnut.slot]);
+
+    // The last hazelnut takes the freed instance, the only one uploaded again.
+    //
+    std::vector<glm::mat4> &model_mats = *model_mats_all_.at((std::size_t)ENTITYKINDenum::HAZELNUT);
+    std::vector<EntityStore::Handle> &hazelnut_handles =
+        instance_handles_.at((std::size_t)ENTITYKINDenum::HAZELNUT);
+    InstanceBuffer &instances = *instance_buffers_.at((std::size_t)ENTITYKINDenum::HAZELNUT);
+    const uint32_t instance = hazelnut_instances_[_hazelnut.slot];
+    const uint32_t last = (uint32_t)model_mats.size() - 1;
+    terrain_->RemoveHazelnut(instance);
+    hazelnut_handles[instance] = hazelnut_handles[last];
+    hazelnut_instances_[hazelnut_handles[instance].slot] = instance;
+    hazelnut_handles.pop_back();
+    instances.Resize(last);
+    if (instance < last)
+    {
+        instances.Set(instance, model_mats[instance]);
+    }
+
+    quad_tree_.Remove(_hazelnut);
+    game_entities_.Remove(_hazelnut);
+}
+
+void GameWorld::drawTerrain(const Camera &camera)
+{
+    if (_terrain_mode_ == TERRAINMODEenum::STREAMING)
+    {
+        terrain_streamer_->Draw(shader_terrain_, camera);
+        return;
+    }
+    terrain_->Draw(shader_terrain_, camera);
+}
+
+void GameWorld::drawSkybox() { skybox_.Draw(shader_skybox_); }
+
+void GameWorld::drawWoodland()
+{
+    // The streamed vectors change every frame and are uploaded whole.
+    //
+    for (std::size_t k = 0; k < model_mats_all_.size(); k++)
+    {
+        if (_terrain_mode_ == TERRAINMODEenum::STREAMING)
+        {
+            archetype((ENTITYKINDenum)k).DrawInstanced(model_mats_all_.at(k));
+            continue;
+        }
+        archetype((ENTITYKINDenum)k).DrawInstanced(*instance_buffers_.at(k));
+    }
+}
+
+TerrainElement &GameWorld::archetype(const ENTITYKINDenum _kind)
+{
+    switch (_kind)
+    {
+    case ENTITYKINDenum::TREE_1:
+        return trrel_tree_1_;
+    case ENTITYKINDenum::TREE_2:
+        return trrel_tree_2_;
+    case ENTITYKINDenum::TREE_3:
+        return trrel_tree_3_;
+    case ENTITYKINDenum::BUSH:
+        return trrel_bush_;
+    case ENTITYKINDenum::ROCK:
+        return trrel_rock_;
+    case ENTITYKINDenum::GRASS:
+        return trrel_grass_;
+    default:
+        return trrel_hazelnut_;
+    }
+}
+
+TERRAINRENDERenum GameWorld::effectiveTerrainRender(const TERRAINMODEenum _terrain_mode,
+                                                    const TERRAINRENDERenum _terrain_render)
+{
+    // Streamed chunks have to match their neighbours along the borders, which the adaptive
+    // mesh does not guarantee, so they fall back to the CDLOD vertex buffers.
+    //
+    if (_terrain_mode == TERRAINMODEenum::STREAMING &&
+        _terrain_render == TERRAINRENDERenum::ADAPTIVE)
+    {
+        return TERRAINRENDERenum::VERTEX_BUFFER;
+    }
+    return _terrain_render;
+}
+
+const char *GameWorld::terrainVertexShader(const TERRAINRENDERenum _terrain_render)
+{
+    switch (_terrain_render)
+    {
+    case TERRAINRENDERenum::HEIGHT_TEXTURE:
+        return "src/Resources/Shaders/Terrain/lowPolyTerrainHeightMap.vert";
+    case TERRAINRENDERenum::ADAPTIVE:
+        return "src/Resources/Shaders/Terrain/lowPolyTerrainRtin.vert";
+    default:
+        return "src/Resources/Shaders/Terrain/lowPolyTerrain.vert";
+    }
+}
+
+const char *GameWorld::terrainFragmentShader(const TERRAINRENDERenum _terrain_render)
+{
+    return _terrain_render == TERRAINRENDERenum::ADAPTIVE
+               ? "src/Resources/Shaders/Terrain/lowPolyTerrainRtin.frag"
+               : "src/Resources/Shaders/Terrain/lowPolyTerrain.frag";
+}
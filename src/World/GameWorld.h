@@ -1,66 +1,129 @@
-#pragma once
-
-#include <iostream>
-#include <vector>
-
-#include <glm/glm.hpp>
-#include <glm/gtc/matrix_transform.hpp>
-#include <glm/gtx/hash.hpp>
-#include <unordered_map>
-#include <utility>
-
-#include <glad/glad.h>
-#include <GLFW/glfw3.h>
-
-#include "Game/Entity.h"
-#include "Game/Player.h"
-#include "Renderer/Camera.h"
-#include "Renderer/Shader.h"
-#include "Renderer/Skybox.h"
-#include "Terrain/Terrain.h"
-#include "World/GObject.h"
-#include "World/QuadTree.h"
-#include "World/TerrainElement.h"
-
-typedef std::vector<std::shared_ptr<std::vector<glm::mat4>>> ModelMatrixVector;
-
-class GameWorld
-{
-public:
-    QuadTree quad_tree_;
-    std::vector<Entity> game_entities_;
-
-    GameWorld(glm::vec3 sun_position = glm::vec3(0.0f, -1.0f, 0.0f), uint32_t grid_size_ = 128);
-
-    void Draw();
-
-    float GetGridHeight(glm::vec3 player_pos);
-    glm::vec3 &GetSunPosition();
-    void SetSunPosition(glm::vec3 new_sun_pos);
-    void RemoveCollectibles(std::vector<Entity> collectible, Player &player);
-
-private:
-    const uint32_t _grid_size_;
-    std::shared_ptr<std::vector<glm::vec3>> grid_;
-
-    Shader shader_terrain_, shader_skybox_, shader_entity_;
-    Skybox skybox_;
-    Terrain terrain_;
-    TerrainElement trrel_tree_1_, trrel_tree_2_, trrel_tree_3_, trrel_bush_, trrel_rock_,
-        trrel_grass_, trrel_hazelnut_;
-
-    ModelMatrixVector model_mats_all_;
-    glm::vec3 sun_position_;
-
-    std::vector<std::pair<glm::mat4, int>> hazelnut_model_mats_pairs_;
-    std::unordered_map<glm::mat4, int, std::hash<glm::mat4>> hazelnut_index_map_;
-
-    void setupModelMatsAll();
-    void createGameEntities();
-    void createQuadTree();
-    void createModelMatPairs();
-    void createIndexMap();
-    void drawTerrain();
-    void drawSkybox();
-    void drawWoodland();
-};
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "Buffers/InstanceBuffer.h"
+#include "Game/Entity.h"
+#include "Game/Player.h"
+#include "Renderer/Camera.h"
+#include "Renderer/Shader.h"
+#include "Renderer/Skybox.h"
+#include "Terrain/DemSource.h"
+#include "Terrain/Terrain.h"
+#include "Terrain/TerrainStreamer.h"
+#include "Types/EEntity.h"
+#include "Types/ETerrain.h"
+#include "World/EntityStore.h"
+#include "World/GObject.h"
+#include "World/QuadTree.h"
+#include "World/TerrainElement.h"
+
+typedef std::vector<std::shared_ptr<std::vector<glm::mat4>>> ModelMatrixVector;
+
+class GameWorld
+{
+public:
+    QuadTree quad_tree_;
+    EntityStore game_entities_;
+
+    // The same world_seed and grid_size_ give the same world, generated on the first start and
+    // loaded from its snapshot afterwards (see Terrain). A dem_path streams the heights of the
+    // elevation data in it instead, a .png as a 16 bit PNG, anything else as a little endian
+    // square RAW file, and needs TERRAINMODEenum::STREAMING.
+    //
+    GameWorld(uint32_t world_seed,
+              glm::vec3 sun_position = glm::vec3(0.0f, -1.0f, 0.0f),
+              uint32_t grid_size_ = 128,
+              TERRAINMODEenum terrain_mode = TERRAINMODEenum::STATIC,
+              TERRAINRENDERenum terrain_render = TERRAINRENDERenum::VERTEX_BUFFER,
+              const std::string &dem_path = "");
+
+    void Update(Player &player);
+    void ResolveCameraCollision(Camera &camera);
+
+    // Raises (positive _amount) or digs the ground around _center with the brush radius. The
+    // streamed terrain is regenerated from its seed and cannot be edited.
+    //
+    void DeformTerrain(const glm::vec3 &_center, const float _amount);
+    void Draw(const Camera &camera);
+
+    float GetGridHeight(glm::vec3 player_pos);
+    glm::vec3 &GetSunPosition();
+
+    // Contents of the TerrainPalette uniform block, one std140 vec4 per element.
+    //
+    std::vector<glm::vec4> &GetTerrainPalette();
+    void SetSunPosition(glm::vec3 new_sun_pos);
+
+    // Collects the hazelnuts in the bounding box of the player from quad_tree_, in constant
+    // time per hazelnut.
+    //
+    void RemoveCollectibles(Player &player);
+
+private:
+    const uint32_t _world_seed_;
+    const uint32_t _grid_size_;
+    const TERRAINMODEenum _terrain_mode_;
+    const TERRAINRENDERenum _terrain_render_;
+    const std::string _dem_path_;
+
+    Shader shader_terrain_, shader_skybox_, shader_entity_;
+    Skybox skybox_;
+    // Exactly one of the two is set, depending on the terrain mode.
+    //
+    std::shared_ptr<Terrain> terrain_;
+    std::shared_ptr<TerrainStreamer> terrain_streamer_;
+    TerrainElement trrel_tree_1_, trrel_tree_2_, trrel_tree_3_, trrel_bush_, trrel_rock_,
+        trrel_grass_, trrel_hazelnut_;
+
+    ModelMatrixVector model_mats_all_;
+    glm::vec3 sun_position_;
+    std::vector<glm::vec4> terrain_palette_;
+
+    // The static terrain draws every kind from its own buffer, uploaded once. The entity of
+    // every instance, by kind, lets a deformation move the entities with their instances. With
+    // the instance of every hazelnut, by the slot of its handle, a pickup moves the last
+    // hazelnut into the freed instance. The snapshot index of every hazelnut, also by slot, is
+    // what Terrain::Collect records.
+    //
+    std::vector<std::shared_ptr<InstanceBuffer>> instance_buffers_;
+    std::vector<std::vector<EntityStore::Handle>> instance_handles_;
+    std::vector<uint32_t> hazelnut_instances_;
+    std::vector<uint32_t> hazelnut_snapshot_indices_;
+
+    static const float _CAMERA_CLEARANCE_;
+    static const float _BRUSH_RADIUS_;
+    static const float _TERRAIN_HEIGHT_SCALE_;
+    static const uint32_t _PICKUP_CAPACITY_;
+
+    void setupTerrain();
+    void setupTerrainPalette();
+    void setupModelMatsAll();
+    void createGameEntities();
+    void createQuadTree();
+    void createInstanceBuffers();
+    void collectHazelnut(const EntityStore::Handle _hazelnut);
+    void drawTerrain(const Camera &camera);
+    void drawSkybox();
+    void drawWoodland();
+
+    // The shared model of every entity of a kind, the player excluded.
+    //
+    TerrainElement &archetype(const ENTITYKINDenum _kind);
+
+    static TERRAINRENDERenum effectiveTerrainRender(const TERRAINMODEenum _terrain_mode,
+                                                    const TERRAINRENDERenum _terrain_render);
+    static const char *terrainVertexShader(const TERRAINRENDERenum _terrain_render);
+    static const char *terrainFragmentShader(const TERRAINRENDERenum _terrain_render);
+};
@@ -1,91 +1,234 @@
-#include "QuadTree.h"
-
-QuadTree::QuadTree(AABB bounding_box)
-    : _node_capacity_(4), bounding_box_(bounding_box), quadrant_1_(nullptr), quadrant_2_(nullptr),
-      quadrant_3_(nullptr), quadrant_4_(nullptr)
-{
-}
-
-QuadTree::~QuadTree()
-{
-    delete quadrant_1_;
-    delete quadrant_2_;
-    delete quadrant_3_;
-    delete quadrant_4_;
-}
-
-bool QuadTree::Insert(Entity ent)
-{
-    if (!bounding_box_.Contains(ent.GetCenter()))
-    {
-        return false;
-    }
-
-    if (entities_.size() < _node_capacity_)
-    {
-        entities_.push_back(ent);
-        return true;
-    }
-
-    if (quadrant_1_ == nullptr)
-    {
-        subdivide();
-    }
-
-    if (quadrant_1_->Insert(ent)) return true;
-    if (quadrant_2_->Insert(ent)) return true;
-    if (quadrant_3_->Insert(ent)) return true;
-    if (quadrant_4_->Insert(ent)) return true;
-
-    // This should never happen.
-    //
-    return false;
-}
-
-std::vector<Entity> QuadTree::Query(AABB range)
-{
-    std::vector<Entity> matching_ents;
-
-    if (!bounding_box_.Collides(range))
-    {
-        return matching_ents;
-    }
-
-    for (std::size_t i = 0; i < entities_.size(); i++)
-    {
-        if (range.Contains(entities_.at(i).bounding_box_.GetCenter()) &&
-            entities_.at(i).IsCollectible())
-        {
-            matching_ents.push_back(entities_.at(i));
-        }
-    }
-
-    if (quadrant_1_ == nullptr)
-    {
-        return matching_ents;
-    }
-
-    std::vector<Entity> match;
-    match = quadrant_1_->Query(range);
-    matching_ents.insert(matching_ents.end(), match.begin(), match.end());
-    match = quadrant_2_->Query(range);
-    matching_ents.insert(matching_ents.end(), match.begin(), match.end());
-    match = quadrant_3_->Query(range);
-    matching_ents.insert(matching_ents.end(), match.begin(), match.end());
-    match = quadrant_4_->Query(range);
-    matching_ents.insert(matching_ents.end(), match.begin(), match.end());
-
-    return matching_ents;
-}
-
-void QuadTree::subdivide()
-{
-    float _x = bounding_box_.center_position.x;
-    float _z = bounding_box_.center_position.z;
-    float _h_dim = bounding_box_.x_half_dim / 2;
-
-    quadrant_1_ = new QuadTree(AABB(glm::vec3(_x + _h_dim, 0.0f, _z - _h_dim), _h_dim));
-    quadrant_2_ = new QuadTree(AABB(glm::vec3(_x - _h_dim, 0.0f, _z - _h_dim), _h_dim));
-    quadrant_3_ = new QuadTree(AABB(glm::vec3(_x - _h_dim, 0.0f, _z + _h_dim), _h_dim));
-    quadrant_4_ = new QuadTree(AABB(glm::vec3(_x + _h_dim, 0.0f, _z + _h_dim), _h_dim));
-}
+#include "QuadTree.h"
+
+// Most entities a node holds before it is split.
+//
+const uint32_t QuadTree::_LEAF_CAPACITY_ = 8;
+
+// The Morton codes have 16 bits per axis, one level of the tree each.
+//
+const uint32_t QuadTree::_MAX_DEPTH_ = 16;
+
+// Entities per task of the code computation and of every radix sort pass.
+//
+const uint32_t QuadTree::_SORT_GRAIN_ = 16384;
+
+// Entry of positions_ for the entities not in the tree.
+//
+const uint32_t QuadTree::_NO_POSITION_ = 0xffffffffu;
+
+QuadTree::QuadTree(AABB bounding_box) : bounding_box_(bounding_box), y_min_(0.0f), y_max_(0.0f) {}
+
+void QuadTree::Build(const EntityStore &entities)
+{
+    // The key of an entity is its Morton code above its dense index, so the sort keeps
+    // entities with the same code in their original order. Entities outside of the box are
+    // marked and dropped before sorting, the sort only looks at the codes, and a marked key
+    // would share its bucket with an entity at the far corner of the box.
+    //
+    const float *center_x = entities.GetCentersX();
+    const float *center_z = entities.GetCentersZ();
+    const uint64_t outside = ~(uint64_t)0;
+    std::vector<uint64_t> keys(entities.GetCount());
+    Parallel::For(0, (uint32_t)keys.size(), _SORT_GRAIN_, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t k = begin; k < end; k++)
+        {
+            const glm::vec3 center(center_x[k], 0.0f, center_z[k]);
+            if (!bounding_box_.Contains(center))
+            {
+                keys[k] = outside;
+                continue;
+            }
+            keys[k] = (uint64_t)mortonCode(glm::vec2(center.x, center.z)) << 32 | k;
+        }
+    });
+    keys.erase(std::remove(keys.begin(), keys.end(), outside), keys.end());
+    radixSort(keys);
+
+    const uint32_t count = (uint32_t)keys.size();
+    points_.resize(count);
+    heights_.resize(count);
+    handles_.resize(count);
+    kinds_.resize(count);
+    positions_.assign(entities.GetSlotCount(), _NO_POSITION_);
+    Parallel::For(0, count, _SORT_GRAIN_, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t k = begin; k < end; k++)
+        {
+            const uint32_t index = (uint32_t)keys[k];
+            points_[k] = glm::vec2(center_x[index], center_z[index]);
+            heights_[k] = entities.GetCentersY()[index];
+            handles_[k] = entities.GetHandles()[index];
+            kinds_[k] = entities.GetKinds()[index];
+            positions_[handles_[k].slot] = k;
+        }
+    });
+    y_min_ = count > 0 ? *std::min_element(heights_.begin(), heights_.end()) : 0.0f;
+    y_max_ = count > 0 ? *std::max_element(heights_.begin(), heights_.end()) : 0.0f;
+    buildNodes(keys);
+    buildKinds();
+}
+
+void QuadTree::Remove(const EntityStore::Handle _entity)
+{
+    if (_entity.slot >= positions_.size() || positions_[_entity.slot] == _NO_POSITION_ ||
+        handles_[positions_[_entity.slot]] != _entity)
+    {
+        return;
+    }
+
+    // The leaf is found from the code of the point, the same code it was sorted by, two bits
+    // per level from the top.
+    //
+    const uint32_t position = positions_[_entity.slot];
+    const uint32_t code = mortonCode(points_[position]);
+    uint32_t n = 0;
+    for (uint32_t shift = 30; nodes_[n].children != 0; shift -= 2)
+    {
+        n = nodes_[n].children + (code >> shift & 3);
+    }
+
+    QuadTree::Node &leaf = nodes_[n];
+    const uint32_t last = leaf.first + leaf.count - 1;
+    points_[position] = points_[last];
+    heights_[position] = heights_[last];
+    handles_[position] = handles_[last];
+    kinds_[position] = kinds_[last];
+    positions_[handles_[position].slot] = position;
+    positions_[_entity.slot] = _NO_POSITION_;
+    leaf.count--;
+}
+
+void QuadTree::SetHeight(const EntityStore::Handle _entity, const float _height)
+{
+    if (_entity.slot >= positions_.size() || positions_[_entity.slot] == _NO_POSITION_ ||
+        handles_[positions_[_entity.slot]] != _entity)
+    {
+        return;
+    }
+
+    // The frustum queries bound every node by the height range, so it grows with the point.
+    //
+    heights_[positions_[_entity.slot]] = _height;
+    y_min_ = std::min(y_min_, _height);
+    y_max_ = std::max(y_max_, _height);
+}
+
+uint32_t QuadTree::Query(AABB range,
+                         const uint32_t _kind_mask,
+                         EntityStore::Handle *entities,
+                         const uint32_t _capacity) const
+{
+    uint32_t count = 0;
+    Query(range, _kind_mask, [&](EntityStore::Handle entity) {
+        if (count < _capacity)
+        {
+            entities[count] = entity;
+        }
+        count++;
+    });
+    return count;
+}
+
+void QuadTree::buildNodes(const std::vector<uint64_t> &keys)
+{
+    // Breadth first, a node over the range of keys sharing its code prefix is split at the
+    // next two bits of the code, found by binary search since the keys are sorted.
+    //
+    nodes_.clear();
+    nodes_.push_back({0, (uint32_t)keys.size(), 0, 0});
+    std::vector<uint8_t> depths(1, 0);
+    for (uint32_t n = 0; n < (uint32_t)nodes_.size(); n++)
+    {
+        const QuadTree::Node node = nodes_[n];
+        const uint32_t depth = depths[n];
+        if (node.count <= _LEAF_CAPACITY_ || depth == _MAX_DEPTH_)
+        {
+            continue;
+        }
+
+        const uint32_t shift = 62 - 2 * depth;
+        const uint32_t end = node.first + node.count;
+        uint32_t begin = node.first;
+        nodes_[n].children = (uint32_t)nodes_.size();
+        for (uint64_t c = 0; c < 4; c++)
+        {
+            const uint32_t child_end =
+                c == 3 ? end
+                       : (uint32_t)(std::partition_point(keys.begin() + begin,
+                                                         keys.begin() + end,
+                                                         [&](const uint64_t key) {
+                                                             return (key >> shift & 3) <= c;
+                                                         }) -
+                                    keys.begin());
+            nodes_.push_back({begin, child_end - begin, 0, 0});
+            depths.push_back((uint8_t)(depth + 1));
+            begin = child_end;
+        }
+    }
+}
+
+void QuadTree::buildKinds()
+{
+    // Children come after their parent, so going backwards every child is done before it is
+    // merged into its parent.
+    //
+    for (uint32_t n = (uint32_t)nodes_.size(); n-- > 0;)
+    {
+        QuadTree::Node &node = nodes_[n];
+        node.kinds = 0;
+        if (node.children != 0)
+        {
+            for (uint32_t c = 0; c < 4; c++)
+            {
+                node.kinds |= nodes_[node.children + c].kinds;
+            }
+            continue;
+        }
+        for (uint32_t k = node.first; k < node.first + node.count; k++)
+        {
+            node.kinds |= KindMask((ENTITYKINDenum)kinds_[k]);
+        }
+    }
+}
+
+void QuadTree::radixSort(std::vector<uint64_t> &keys)
+{
+    // LSD radix sort of the upper 32 bits, a byte per pass. Every task counts the digits of
+    // its own chunk, the counts are summed digit by digit over the chunks in order, and every
+    // task scatters its chunk to its own offsets, so the sort is stable on any thread count.
+    //
+    const uint32_t count = (uint32_t)keys.size();
+    const uint32_t chunks = (count + _SORT_GRAIN_ - 1) / _SORT_GRAIN_;
+    std::vector<uint64_t> sorted(count);
+    std::vector<uint32_t> offsets((std::size_t)chunks * 256);
+    for (uint32_t shift = 32; shift < 64; shift += 8)
+    {
+        std::fill(offsets.begin(), offsets.end(), 0);
+        Parallel::For(0, count, _SORT_GRAIN_, [&](uint32_t begin, uint32_t end) {
+            uint32_t *digits = offsets.data() + (std::size_t)(begin / _SORT_GRAIN_) * 256;
+            for (uint32_t k = begin; k < end; k++)
+            {
+                digits[keys[k] >> shift & 255]++;
+            }
+        });
+
+        uint32_t offset = 0;
+        for (uint32_t d = 0; d < 256; d++)
+        {
+            for (uint32_t c = 0; c < chunks; c++)
+            {
+                const uint32_t digit_count = offsets[(std::size_t)c * 256 + d];
+                offsets[(std::size_t)c * 256 + d] = offset;
+                offset += digit_count;
+            }
+        }
+
+        Parallel::For(0, count, _SORT_GRAIN_, [&](uint32_t begin, uint32_t end) {
+            uint32_t *digits = offsets.data() + (std::size_t)(begin / _SORT_GRAIN_) * 256;
+            for (uint32_t k = begin; k < end; k++)
+            {
+                sorted[digits[keys[k] >> shift & 255]++] = keys[k];
+            }
+        });
+        keys.swap(sorted);
+    }
+}
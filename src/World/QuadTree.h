@@ -1,36 +1,312 @@
-#pragma once
-
-#include <iostream>
-#include <vector>
-
-#include "Game/Entity.h"
-#include "Types/AABB.h"
-
-// This is a point region quadtree implementation.
-// Also the Y dimension is being ignored, since the game objects
-// are static objects positioned beforehand at game initialization.
-// Since the player can only move on the terrain level, we only need
-// to check X and Z dimensions to determine if a collision has occured.
-//
-class QuadTree
-{
-public:
-    QuadTree(AABB bounding_box);
-    ~QuadTree();
-
-    bool Insert(Entity ent);
-    std::vector<Entity> Query(AABB range);
-
-private:
-    const uint32_t _node_capacity_;
-
-    AABB bounding_box_;
-    std::vector<Entity> entities_;
-
-    QuadTree *quadrant_1_;
-    QuadTree *quadrant_2_;
-    QuadTree *quadrant_3_;
-    QuadTree *quadrant_4_;
-
-    void subdivide();
-};
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Application/Parallel.h"
+#include "Types/AABB.h"
+#include "Types/EEntity.h"
+#include "Types/Frustum.h"
+#include "World/EntityStore.h"
+
+// This is a point region quadtree implementation.
+// Also the Y dimension is being ignored, since the game objects
+// are static objects positioned beforehand at game initialization.
+// Since the player can only move on the terrain level, we only need
+// to check X and Z dimensions to determine if a collision has occured.
+//
+// The tree is linear. The entity centers are quantized to 16 bits per axis inside of the
+// bounding box and sorted by their Morton code, which puts the entities of every node next to
+// each other, so a node is just a range of the sorted entities. The nodes live in one array,
+// the four children of a node are consecutive and found by index, so the tree is walked
+// without pointers and the points of a leaf are read from one contiguous run.
+//
+// Build computes the codes and radix sorts them on all cores, then splits the ranges level by
+// level, O(n) in the number of entities. Entities outside of the bounding box are left out.
+//
+// The queries hand every entity whose center is in the shape and whose kind is in the mask to
+// a visitor, as its EntityStore handle, and allocate nothing. Every node knows the kinds below
+// it, so a query for a rare kind skips the subtrees without any.
+//
+// Remove takes an entity out of its leaf in O(depth), the last point of the leaf moves into
+// its place. The nodes are not rebalanced and the kinds of a node stay as built, a superset of
+// what is left below it, which only costs a few visits until the next Build.
+//
+class QuadTree
+{
+public:
+    struct Circle
+    {
+        glm::vec2 center;
+        float radius;
+    };
+
+    QuadTree(AABB bounding_box);
+
+    void Build(const EntityStore &entities);
+
+    // Removes an entity of the last Build, nothing happens for any other handle. Not to be
+    // called from inside of a query visitor.
+    //
+    void Remove(const EntityStore::Handle _entity);
+
+    // Moves an entity of the last Build to the center height _height, for the entities that
+    // follow the ground. Their X and Z, and so the node they are in, stay the same. Nothing
+    // happens for any other handle.
+    //
+    void SetHeight(const EntityStore::Handle _entity, const float _height);
+
+    // Calls visit(EntityStore::Handle entity) in Morton order. range ignores Y.
+    //
+    template <class F> void Query(AABB range, const uint32_t _kind_mask, F visit) const;
+    template <class F>
+    void Query(const QuadTree::Circle &circle, const uint32_t _kind_mask, F visit) const;
+
+    // Tests the centers against the frustum, Y included.
+    //
+    template <class F> void Query(const Frustum &frustum, const uint32_t _kind_mask, F visit) const;
+
+    // Writes up to _capacity matching entities to entities and returns how many match in
+    // total, so a result larger than the span is noticed.
+    //
+    uint32_t Query(AABB range,
+                   const uint32_t _kind_mask,
+                   EntityStore::Handle *entities,
+                   const uint32_t _capacity) const;
+
+    static uint32_t KindMask(const ENTITYKINDenum _kind);
+
+private:
+    struct Node
+    {
+        uint32_t first;
+        uint32_t count;
+
+        // Index of the first of the four children, 0 for a leaf. The root is never a child.
+        //
+        uint32_t children;
+
+        // One bit per ENTITYKINDenum of the entities in the node.
+        //
+        uint32_t kinds;
+    };
+
+    // A node on the traversal stack with the corner and the edge length of its square.
+    //
+    struct NodeBounds
+    {
+        uint32_t node;
+        float x_min;
+        float z_min;
+        float size;
+    };
+
+    // The shapes a query walks the tree with. Overlaps tests a node square, Contains an entity
+    // center and its height.
+    //
+    struct RangeShape
+    {
+        float x_min, x_max, z_min, z_max;
+
+        bool Overlaps(const float _x_min, const float _z_min, const float _size) const;
+        bool Contains(const glm::vec2 &_point, const float _height) const;
+    };
+
+    struct CircleShape
+    {
+        QuadTree::Circle circle;
+
+        bool Overlaps(const float _x_min, const float _z_min, const float _size) const;
+        bool Contains(const glm::vec2 &_point, const float _height) const;
+    };
+
+    struct FrustumShape
+    {
+        const Frustum &frustum;
+        float y_min, y_max;
+
+        bool Overlaps(const float _x_min, const float _z_min, const float _size) const;
+        bool Contains(const glm::vec2 &_point, const float _height) const;
+    };
+
+    AABB bounding_box_;
+    std::vector<Node> nodes_;
+
+    // The entities in Morton order.
+    //
+    std::vector<glm::vec2> points_;
+    std::vector<float> heights_;
+    std::vector<EntityStore::Handle> handles_;
+    std::vector<uint8_t> kinds_;
+    float y_min_, y_max_;
+
+    // Position of every entity in the arrays above, by the slot of its handle, _NO_POSITION_
+    // for the entities not in the tree.
+    //
+    std::vector<uint32_t> positions_;
+
+    static const uint32_t _LEAF_CAPACITY_;
+    static const uint32_t _MAX_DEPTH_;
+    static const uint32_t _SORT_GRAIN_;
+    static const uint32_t _NO_POSITION_;
+
+    void buildNodes(const std::vector<uint64_t> &keys);
+    void buildKinds();
+
+    template <class S, class F>
+    void query(const S &shape, const uint32_t _kind_mask, F visit) const;
+
+    uint32_t mortonCode(const glm::vec2 &_point) const;
+
+    static uint32_t spreadBits(uint32_t v);
+    static void radixSort(std::vector<uint64_t> &keys);
+};
+
+template <class F> inline void QuadTree::Query(AABB range, const uint32_t _kind_mask, F visit) const
+{
+    const QuadTree::RangeShape shape{range.XMin(), range.XMax(), range.ZMin(), range.ZMax()};
+    query(shape, _kind_mask, visit);
+}
+
+template <class F>
+inline void QuadTree::Query(const QuadTree::Circle &circle,
+                            const uint32_t _kind_mask,
+                            F visit) const
+{
+    query(QuadTree::CircleShape{circle}, _kind_mask, visit);
+}
+
+template <class F>
+inline void QuadTree::Query(const Frustum &frustum, const uint32_t _kind_mask, F visit) const
+{
+    query(QuadTree::FrustumShape{frustum, y_min_, y_max_}, _kind_mask, visit);
+}
+
+inline uint32_t QuadTree::KindMask(const ENTITYKINDenum _kind) { return 1u << (uint32_t)_kind; }
+
+template <class S, class F>
+inline void QuadTree::query(const S &shape, const uint32_t _kind_mask, F visit) const
+{
+    if (nodes_.empty())
+    {
+        return;
+    }
+
+    // The node squares are grown by one quantization step, so a point rounded into a
+    // neighbouring node is never culled. The points are tested exactly.
+    //
+    const float size = 2.0f * bounding_box_.x_half_dim;
+    const float margin = size / 65536.0f;
+
+    // Every level pushes at most three siblings of the next node to visit.
+    //
+    std::array<QuadTree::NodeBounds, 64> stack;
+    uint32_t top = 0;
+    stack[top++] = {0, bounding_box_.center_position.x - bounding_box_.x_half_dim,
+                    bounding_box_.center_position.z - bounding_box_.x_half_dim, size};
+    while (top > 0)
+    {
+        const QuadTree::NodeBounds bounds = stack[--top];
+        const QuadTree::Node &node = nodes_[bounds.node];
+        if ((node.kinds & _kind_mask) == 0 || !shape.Overlaps(bounds.x_min - margin,
+                                                              bounds.z_min - margin,
+                                                              bounds.size + 2.0f * margin))
+        {
+            continue;
+        }
+
+        if (node.children == 0)
+        {
+            for (uint32_t k = node.first; k < node.first + node.count; k++)
+            {
+                if ((_kind_mask >> kinds_[k] & 1) != 0 && shape.Contains(points_[k], heights_[k]))
+                {
+                    visit(handles_[k]);
+                }
+            }
+            continue;
+        }
+
+        // Pushed in reverse, so the children are visited in Morton order. Bit 0 of a child
+        // is its x half, bit 1 its z half.
+        //
+        const float half = bounds.size * 0.5f;
+        for (int c = 3; c >= 0; c--)
+        {
+            stack[top++] = {node.children + c,
+                            bounds.x_min + (float)(c & 1) * half,
+                            bounds.z_min + (float)(c >> 1) * half,
+                            half};
+        }
+    }
+}
+
+inline bool QuadTree::RangeShape::Overlaps(const float _x_min,
+                                           const float _z_min,
+                                           const float _size) const
+{
+    return _x_min <= x_max && _x_min + _size >= x_min && _z_min <= z_max &&
+           _z_min + _size >= z_min;
+}
+
+inline bool QuadTree::RangeShape::Contains(const glm::vec2 &_point, const float) const
+{
+    return _point.x >= x_min && _point.x <= x_max && _point.y >= z_min && _point.y <= z_max;
+}
+
+inline bool QuadTree::CircleShape::Overlaps(const float _x_min,
+                                            const float _z_min,
+                                            const float _size) const
+{
+    const glm::vec2 corner(_x_min, _z_min);
+    const glm::vec2 nearest = glm::clamp(circle.center, corner, corner + _size);
+    const glm::vec2 offset = circle.center - nearest;
+    return glm::dot(offset, offset) <= circle.radius * circle.radius;
+}
+
+inline bool QuadTree::CircleShape::Contains(const glm::vec2 &_point, const float) const
+{
+    const glm::vec2 offset = _point - circle.center;
+    return glm::dot(offset, offset) <= circle.radius * circle.radius;
+}
+
+inline bool QuadTree::FrustumShape::Overlaps(const float _x_min,
+                                             const float _z_min,
+                                             const float _size) const
+{
+    const float half = _size * 0.5f;
+    return frustum.Intersects(AABB(glm::vec3(_x_min + half, (y_min + y_max) * 0.5f, _z_min + half),
+                                   half,
+                                   (y_max - y_min) * 0.5f,
+                                   half));
+}
+
+inline bool QuadTree::FrustumShape::Contains(const glm::vec2 &_point, const float _height) const
+{
+    return frustum.Intersects(AABB(glm::vec3(_point.x, _height, _point.y), 0.0f));
+}
+
+inline uint32_t QuadTree::mortonCode(const glm::vec2 &_point) const
+{
+    const float x_min = bounding_box_.center_position.x - bounding_box_.x_half_dim;
+    const float z_min = bounding_box_.center_position.z - bounding_box_.z_half_dim;
+    const float scale = 65536.0f / (2.0f * bounding_box_.x_half_dim);
+    const uint32_t x = std::min((uint32_t)((_point.x - x_min) * scale), 65535u);
+    const uint32_t z = std::min((uint32_t)((_point.y - z_min) * scale), 65535u);
+    return spreadBits(x) | spreadBits(z) << 1;
+}
+
+inline uint32_t QuadTree::spreadBits(uint32_t v)
+{
+    v &= 0x0000ffff;
+    v = (v | (v << 8)) & 0x00ff00ff;
+    v = (v | (v << 4)) & 0x0f0f0f0f;
+    v = (v | (v << 2)) & 0x33333333;
+    v = (v | (v << 1)) & 0x55555555;
+    return v;
+}